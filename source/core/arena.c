@@ -0,0 +1,144 @@
+#include <malloc.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <3ds.h>
+
+#include "arena.h"
+
+#define ARENA_ALIGN 8
+
+typedef struct arena_block_s {
+    struct arena_block_s* next;
+    size_t used;
+    size_t size;
+} arena_block;
+
+struct arena_s {
+    LightLock lock;
+    u32 refs;
+
+    size_t blockSize;
+    arena_block* blocks;
+};
+
+static arena_block* arena_create_block(size_t size) {
+    arena_block* block = (arena_block*) malloc(sizeof(arena_block) + size);
+    if(block != NULL) {
+        block->next = NULL;
+        block->used = 0;
+        block->size = size;
+    }
+
+    return block;
+}
+
+static void* arena_block_alloc(arena_block* block, size_t size) {
+    uintptr_t base = (uintptr_t) (block + 1);
+    uintptr_t start = (base + block->used + ARENA_ALIGN - 1) & ~(uintptr_t) (ARENA_ALIGN - 1);
+    if(start + size > base + block->size) {
+        return NULL;
+    }
+
+    block->used = start + size - base;
+    return (void*) start;
+}
+
+arena* arena_create(size_t blockSize) {
+    arena* a = (arena*) calloc(1, sizeof(arena));
+    if(a != NULL) {
+        LightLock_Init(&a->lock);
+        a->refs = 1;
+        a->blockSize = blockSize;
+        a->blocks = NULL;
+    }
+
+    return a;
+}
+
+void arena_retain(arena* a) {
+    if(a == NULL) {
+        return;
+    }
+
+    LightLock_Lock(&a->lock);
+    a->refs++;
+    LightLock_Unlock(&a->lock);
+}
+
+// Frees every block at once when the last reference goes away.
+void arena_release(arena* a) {
+    if(a == NULL) {
+        return;
+    }
+
+    LightLock_Lock(&a->lock);
+    u32 refs = --a->refs;
+    LightLock_Unlock(&a->lock);
+
+    if(refs > 0) {
+        return;
+    }
+
+    arena_block* block = a->blocks;
+    while(block != NULL) {
+        arena_block* next = block->next;
+        free(block);
+        block = next;
+    }
+
+    free(a);
+}
+
+void* arena_alloc(arena* a, size_t size) {
+    if(a == NULL) {
+        return NULL;
+    }
+
+    void* ptr = NULL;
+
+    LightLock_Lock(&a->lock);
+
+    if(a->blocks != NULL) {
+        ptr = arena_block_alloc(a->blocks, size);
+    }
+
+    if(ptr == NULL) {
+        // Allocations larger than a block get one of their own behind the current block, so
+        // the space left in the current block is not abandoned.
+        bool oversized = size + ARENA_ALIGN > a->blockSize;
+
+        arena_block* block = arena_create_block(oversized ? size + ARENA_ALIGN : a->blockSize);
+        if(block != NULL) {
+            ptr = arena_block_alloc(block, size);
+
+            if(oversized && a->blocks != NULL) {
+                block->next = a->blocks->next;
+                a->blocks->next = block;
+            } else {
+                block->next = a->blocks;
+                a->blocks = block;
+            }
+        }
+    }
+
+    LightLock_Unlock(&a->lock);
+
+    if(ptr != NULL) {
+        memset(ptr, 0, size);
+    }
+
+    return ptr;
+}
+
+char* arena_strdup(arena* a, const char* str) {
+    size_t len = strlen(str);
+
+    char* copy = (char*) arena_alloc(a, len + 1);
+    if(copy != NULL) {
+        memcpy(copy, str, len + 1);
+    }
+
+    return copy;
+}
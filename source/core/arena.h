@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stddef.h>
+
+typedef struct arena_s arena;
+
+arena* arena_create(size_t blockSize);
+void arena_retain(arena* a);
+void arena_release(arena* a);
+
+void* arena_alloc(arena* a, size_t size);
+char* arena_strdup(arena* a, const char* str);
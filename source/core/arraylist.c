@@ -0,0 +1,305 @@
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arraylist.h"
+
+#define ARRAY_LIST_MIN_CAPACITY 16
+
+void array_list_init(array_list* list) {
+    memset(list, 0, sizeof(array_list));
+}
+
+static void array_list_free_retired(array_list* list) {
+    for(unsigned int i = 0; i < list->retiredCount; i++) {
+        free(list->retired[i]);
+        list->retired[i] = NULL;
+    }
+
+    list->retiredCount = 0;
+}
+
+void array_list_destroy(array_list* list) {
+    array_list_free_retired(list);
+
+    if(list->items != NULL) {
+        free(list->items);
+    }
+
+    array_list_init(list);
+}
+
+unsigned int array_list_size(array_list* list) {
+    return list->size;
+}
+
+void array_list_clear(array_list* list) {
+    array_list_free_retired(list);
+
+    list->offset = 0;
+    list->size = 0;
+}
+
+bool array_list_contains(array_list* list, void* value) {
+    return array_list_index_of(list, value) != -1;
+}
+
+int array_list_index_of(array_list* list, void* value) {
+    void** items = list->items + list->offset;
+    for(unsigned int i = 0; i < list->size; i++) {
+        if(items[i] == value) {
+            return (int) i;
+        }
+    }
+
+    return -1;
+}
+
+void* array_list_get(array_list* list, unsigned int index) {
+    if(index >= list->size) {
+        return NULL;
+    }
+
+    return list->items[list->offset + index];
+}
+
+// Grows into a new buffer rather than reallocating in place. Buffers that may still be read
+// by a thread iterating the list are retired and only freed on clear or destroy.
+static bool array_list_grow(array_list* list) {
+    unsigned int capacity = list->size * 2;
+    if(capacity < ARRAY_LIST_MIN_CAPACITY) {
+        capacity = ARRAY_LIST_MIN_CAPACITY;
+    }
+
+    void** items = (void**) calloc(capacity, sizeof(void*));
+    if(items == NULL) {
+        return false;
+    }
+
+    if(list->items != NULL) {
+        memcpy(items, list->items + list->offset, list->size * sizeof(void*));
+
+        if(list->retiredCount < ARRAY_LIST_MAX_RETIRED) {
+            list->retired[list->retiredCount++] = list->items;
+        } else {
+            free(list->items);
+        }
+    }
+
+    __sync_synchronize();
+
+    list->items = items;
+    list->offset = 0;
+    list->capacity = capacity;
+    return true;
+}
+
+bool array_list_add(array_list* list, void* value) {
+    if(list->offset + list->size >= list->capacity && !array_list_grow(list)) {
+        return false;
+    }
+
+    list->items[list->offset + list->size] = value;
+
+    __sync_synchronize();
+
+    list->size++;
+    return true;
+}
+
+bool array_list_add_at(array_list* list, unsigned int index, void* value) {
+    if(index > list->size) {
+        return false;
+    }
+
+    if(index == list->size) {
+        return array_list_add(list, value);
+    }
+
+    if(index == 0 && list->offset > 0) {
+        list->items[--list->offset] = value;
+        list->size++;
+        return true;
+    }
+
+    if(list->offset + list->size >= list->capacity && !array_list_grow(list)) {
+        return false;
+    }
+
+    void** items = list->items + list->offset;
+    memmove(&items[index + 1], &items[index], (list->size - index) * sizeof(void*));
+    items[index] = value;
+
+    list->size++;
+    return true;
+}
+
+// Binary searches for the first item that sorts after the value, keeping insertion order
+// among equal items.
+void array_list_add_sorted(array_list* list, void* value, void* userData, int (*compare)(void* userData, const void* p1, const void* p2)) {
+    if(compare == NULL) {
+        array_list_add(list, value);
+        return;
+    }
+
+    unsigned int low = 0;
+    unsigned int high = list->size;
+    while(low < high) {
+        unsigned int mid = low + (high - low) / 2;
+        if(compare(userData, value, list->items[list->offset + mid]) < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+
+    array_list_add_at(list, low, value);
+}
+
+bool array_list_remove(array_list* list, void* value) {
+    bool found = false;
+
+    for(unsigned int i = 0; i < list->size;) {
+        if(list->items[list->offset + i] == value) {
+            found = true;
+
+            array_list_remove_at(list, i);
+        } else {
+            i++;
+        }
+    }
+
+    return found;
+}
+
+// Shifts whichever side of the removed item is shorter, so removing from either end is O(1).
+bool array_list_remove_at(array_list* list, unsigned int index) {
+    if(index >= list->size) {
+        return false;
+    }
+
+    void** items = list->items + list->offset;
+    if(index < list->size / 2) {
+        memmove(&items[1], &items[0], index * sizeof(void*));
+        items[0] = NULL;
+
+        list->offset++;
+    } else {
+        memmove(&items[index], &items[index + 1], (list->size - index - 1) * sizeof(void*));
+        items[list->size - 1] = NULL;
+    }
+
+    list->size--;
+
+    if(list->size == 0) {
+        list->offset = 0;
+    }
+
+    return true;
+}
+
+// Stable bottom-up merge sort. Falls back to an in-place insertion sort if the scratch
+// buffer cannot be allocated.
+void array_list_sort(array_list* list, void* userData, int (*compare)(void* userData, const void* p1, const void* p2)) {
+    if(list->size < 2) {
+        return;
+    }
+
+    void** items = list->items + list->offset;
+
+    void** scratch = (void**) calloc(list->size, sizeof(void*));
+    if(scratch == NULL) {
+        for(unsigned int i = 1; i < list->size; i++) {
+            void* value = items[i];
+
+            unsigned int j = i;
+            while(j > 0 && compare(userData, items[j - 1], value) > 0) {
+                items[j] = items[j - 1];
+                j--;
+            }
+
+            items[j] = value;
+        }
+
+        return;
+    }
+
+    void** src = items;
+    void** dst = scratch;
+
+    for(unsigned int width = 1; width < list->size; width *= 2) {
+        for(unsigned int start = 0; start < list->size; start += width * 2) {
+            unsigned int mid = start + width < list->size ? start + width : list->size;
+            unsigned int end = start + width * 2 < list->size ? start + width * 2 : list->size;
+
+            unsigned int left = start;
+            unsigned int right = mid;
+            unsigned int out = start;
+
+            while(left < mid && right < end) {
+                if(compare(userData, src[left], src[right]) <= 0) {
+                    dst[out++] = src[left++];
+                } else {
+                    dst[out++] = src[right++];
+                }
+            }
+
+            while(left < mid) {
+                dst[out++] = src[left++];
+            }
+
+            while(right < end) {
+                dst[out++] = src[right++];
+            }
+        }
+
+        void** temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if(src != items) {
+        memcpy(items, src, list->size * sizeof(void*));
+    }
+
+    free(scratch);
+}
+
+void array_list_iterate(array_list* list, array_list_iter* iter) {
+    iter->list = list;
+    array_list_iter_restart(iter);
+}
+
+void array_list_iter_restart(array_list_iter* iter) {
+    if(iter->list == NULL) {
+        return;
+    }
+
+    iter->curr = -1;
+    iter->next = 0;
+}
+
+bool array_list_iter_has_next(array_list_iter* iter) {
+    return iter->next < iter->list->size && array_list_get(iter->list, iter->next) != NULL;
+}
+
+void* array_list_iter_next(array_list_iter* iter) {
+    void* value = array_list_get(iter->list, iter->next);
+    if(value == NULL) {
+        return NULL;
+    }
+
+    iter->curr = (int) iter->next;
+    iter->next++;
+    return value;
+}
+
+void array_list_iter_remove(array_list_iter* iter) {
+    if(iter->curr < 0) {
+        return;
+    }
+
+    array_list_remove_at(iter->list, (unsigned int) iter->curr);
+    iter->next = (unsigned int) iter->curr;
+    iter->curr = -1;
+}
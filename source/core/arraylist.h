@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdbool.h>
+
+#define ARRAY_LIST_MAX_RETIRED 32
+
+typedef struct array_list_s {
+    void** items;
+    unsigned int offset;
+    unsigned int size;
+    unsigned int capacity;
+
+    void** retired[ARRAY_LIST_MAX_RETIRED];
+    unsigned int retiredCount;
+} array_list;
+
+typedef struct array_list_iter_s {
+    array_list* list;
+    int curr;
+    unsigned int next;
+} array_list_iter;
+
+void array_list_init(array_list* list);
+void array_list_destroy(array_list* list);
+
+unsigned int array_list_size(array_list* list);
+void array_list_clear(array_list* list);
+bool array_list_contains(array_list* list, void* value);
+int array_list_index_of(array_list* list, void* value);
+void* array_list_get(array_list* list, unsigned int index);
+bool array_list_add(array_list* list, void* value);
+bool array_list_add_at(array_list* list, unsigned int index, void* value);
+void array_list_add_sorted(array_list* list, void* value, void* userData, int (*compare)(void* userData, const void* p1, const void* p2));
+bool array_list_remove(array_list* list, void* value);
+bool array_list_remove_at(array_list* list, unsigned int index);
+void array_list_sort(array_list* list, void* userData, int (*compare)(void* userData, const void* p1, const void* p2));
+
+void array_list_iterate(array_list* list, array_list_iter* iter);
+
+void array_list_iter_restart(array_list_iter* iter);
+bool array_list_iter_has_next(array_list_iter* iter);
+void* array_list_iter_next(array_list_iter* iter);
+void array_list_iter_remove(array_list_iter* iter);
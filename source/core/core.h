@@ -4,11 +4,13 @@
 #include "task/task.h"
 #include "ui/ui.h"
 
+#include "arena.h"
+#include "arraylist.h"
 #include "clipboard.h"
 #include "error.h"
 #include "fs.h"
+#include "hashmap.h"
 #include "http.h"
-#include "linkedlist.h"
 #include "screen.h"
 #include "spi.h"
 #include "stringutil.h"
\ No newline at end of file
@@ -4,9 +4,9 @@
 
 #include <3ds.h>
 
+#include "arraylist.h"
 #include "error.h"
 #include "fs.h"
-#include "linkedlist.h"
 #include "stringutil.h"
 
 bool fs_is_dir(FS_Archive archive, const char* path) {
@@ -86,7 +86,7 @@ typedef struct {
     u32 refs;
 } archive_ref;
 
-static linked_list opened_archives;
+static array_list opened_archives;
 
 Result fs_open_archive(FS_Archive* archive, FS_ArchiveID id, FS_Path path) {
     if(archive == NULL) {
@@ -108,11 +108,11 @@ Result fs_open_archive(FS_Archive* archive, FS_ArchiveID id, FS_Path path) {
 }
 
 Result fs_ref_archive(FS_Archive archive) {
-    linked_list_iter iter;
-    linked_list_iterate(&opened_archives, &iter);
+    array_list_iter iter;
+    array_list_iterate(&opened_archives, &iter);
 
-    while(linked_list_iter_has_next(&iter)) {
-        archive_ref* ref = (archive_ref*) linked_list_iter_next(&iter);
+    while(array_list_iter_has_next(&iter)) {
+        archive_ref* ref = (archive_ref*) array_list_iter_next(&iter);
         if(ref->archive == archive) {
             ref->refs++;
             return 0;
@@ -126,7 +126,7 @@ Result fs_ref_archive(FS_Archive archive) {
         ref->archive = archive;
         ref->refs = 1;
 
-        linked_list_add(&opened_archives, ref);
+        array_list_add(&opened_archives, ref);
     } else {
         res = R_APP_OUT_OF_MEMORY;
     }
@@ -135,16 +135,16 @@ Result fs_ref_archive(FS_Archive archive) {
 }
 
 Result fs_close_archive(FS_Archive archive) {
-    linked_list_iter iter;
-    linked_list_iterate(&opened_archives, &iter);
+    array_list_iter iter;
+    array_list_iterate(&opened_archives, &iter);
 
-    while(linked_list_iter_has_next(&iter)) {
-        archive_ref* ref = (archive_ref*) linked_list_iter_next(&iter);
+    while(array_list_iter_has_next(&iter)) {
+        archive_ref* ref = (archive_ref*) array_list_iter_next(&iter);
         if(ref->archive == archive) {
             ref->refs--;
 
             if(ref->refs == 0) {
-                linked_list_iter_remove(&iter);
+                array_list_iter_remove(&iter);
                 free(ref);
             } else {
                 return 0;
@@ -0,0 +1,81 @@
+#include <string.h>
+
+#include <3ds.h>
+
+#include "arena.h"
+#include "glyphcache.h"
+#include "hashmap.h"
+
+// Glyph metrics are looked up once per code point and kept at unit scale, since everything
+// fontCalcGlyphPos returns scales linearly. Latin code points live in a dense table and the
+// rest in a map backed by an arena.
+#define GLYPH_CACHE_DENSE 0x180
+#define GLYPH_CACHE_ARENA_BLOCK_SIZE 0x2000
+
+static glyph_info glyph_cache_dense[GLYPH_CACHE_DENSE];
+static hash_map glyph_cache;
+static arena* glyph_cache_arena;
+
+static void glyph_cache_load(glyph_info* glyph, u32 code) {
+    int index = fontGlyphIndexFromCodePoint(NULL, code);
+
+    fontGlyphPos_s data;
+    fontCalcGlyphPos(&data, NULL, index, GLYPH_POS_CALC_VTXCOORD, 1.0f, 1.0f);
+
+    if(data.sheetIndex >= fontGetGlyphInfo(NULL)->nSheets) {
+        fontCalcGlyphPos(&data, NULL, fontGlyphIndexFromCodePoint(NULL, 0xFFFD), GLYPH_POS_CALC_VTXCOORD, 1.0f, 1.0f);
+    }
+
+    glyph->cached = true;
+    glyph->sheet = (u32) data.sheetIndex;
+    glyph->charWidth = fontGetCharWidthInfo(NULL, index)->charWidth;
+    glyph->xAdvance = data.xAdvance;
+    glyph->left = data.vtxcoord.left;
+    glyph->top = data.vtxcoord.top;
+    glyph->right = data.vtxcoord.right;
+    glyph->bottom = data.vtxcoord.bottom;
+    glyph->texLeft = data.texcoord.left;
+    glyph->texBottom = data.texcoord.bottom;
+    glyph->texRight = data.texcoord.right;
+    glyph->texTop = data.texcoord.top;
+}
+
+const glyph_info* glyph_cache_get(u32 code) {
+    if(code < GLYPH_CACHE_DENSE) {
+        glyph_info* glyph = &glyph_cache_dense[code];
+        if(!glyph->cached) {
+            glyph_cache_load(glyph, code);
+        }
+
+        return glyph;
+    }
+
+    glyph_info* glyph = (glyph_info*) hash_map_get(&glyph_cache, code);
+    if(glyph == NULL) {
+        if(glyph_cache_arena == NULL) {
+            glyph_cache_arena = arena_create(GLYPH_CACHE_ARENA_BLOCK_SIZE);
+        }
+
+        if(glyph_cache_arena == NULL || (glyph = (glyph_info*) arena_alloc(glyph_cache_arena, sizeof(glyph_info))) == NULL) {
+            // Out of memory; fall back to a single scratch entry that is recomputed every time.
+            static glyph_info scratch;
+            glyph_cache_load(&scratch, code);
+            return &scratch;
+        }
+
+        glyph_cache_load(glyph, code);
+        hash_map_put(&glyph_cache, code, glyph);
+    }
+
+    return glyph;
+}
+
+void glyph_cache_clear() {
+    memset(glyph_cache_dense, 0, sizeof(glyph_cache_dense));
+    hash_map_destroy(&glyph_cache);
+
+    if(glyph_cache_arena != NULL) {
+        arena_release(glyph_cache_arena);
+        glyph_cache_arena = NULL;
+    }
+}
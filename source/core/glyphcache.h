@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <3ds.h>
+
+// Metrics of one system font glyph at unit scale.
+typedef struct glyph_info_s {
+    bool cached;
+    u32 sheet;
+    float charWidth;
+    float xAdvance;
+    float left;
+    float top;
+    float right;
+    float bottom;
+    float texLeft;
+    float texBottom;
+    float texRight;
+    float texTop;
+} glyph_info;
+
+const glyph_info* glyph_cache_get(u32 code);
+void glyph_cache_clear();
@@ -0,0 +1,328 @@
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <3ds.h>
+
+#include "hashmap.h"
+
+#define HASH_MAP_MIN_CAPACITY 16
+
+#define SLOT_EMPTY 0
+#define SLOT_USED 1
+#define SLOT_DELETED 2
+
+static u32 hash_map_hash(u64 key) {
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+
+    return (u32) key;
+}
+
+static u32 string_map_hash(const char* key) {
+    u32 hash = 2166136261U;
+    while(*key != '\0') {
+        hash ^= (u8) *key++;
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+// Capacity is always a power of two, grown before used slots (including deleted ones) pass
+// three quarters of it.
+static u32 hash_map_next_capacity(u32 size, u32 capacity) {
+    if(capacity < HASH_MAP_MIN_CAPACITY) {
+        capacity = HASH_MAP_MIN_CAPACITY;
+    }
+
+    while((size + 1) * 4 > capacity * 3) {
+        capacity <<= 1;
+    }
+
+    return capacity;
+}
+
+void hash_map_init(hash_map* map) {
+    memset(map, 0, sizeof(hash_map));
+}
+
+void hash_map_destroy(hash_map* map) {
+    if(map->keys != NULL) {
+        free(map->keys);
+    }
+
+    if(map->values != NULL) {
+        free(map->values);
+    }
+
+    if(map->states != NULL) {
+        free(map->states);
+    }
+
+    hash_map_init(map);
+}
+
+u32 hash_map_size(hash_map* map) {
+    return map->size;
+}
+
+void hash_map_clear(hash_map* map) {
+    if(map->states != NULL) {
+        memset(map->states, SLOT_EMPTY, map->capacity);
+    }
+
+    map->size = 0;
+    map->used = 0;
+}
+
+static int hash_map_find(hash_map* map, u64 key) {
+    if(map->capacity == 0) {
+        return -1;
+    }
+
+    u32 mask = map->capacity - 1;
+    for(u32 pos = hash_map_hash(key) & mask; map->states[pos] != SLOT_EMPTY; pos = (pos + 1) & mask) {
+        if(map->states[pos] == SLOT_USED && map->keys[pos] == key) {
+            return (int) pos;
+        }
+    }
+
+    return -1;
+}
+
+static void hash_map_insert(hash_map* map, u64 key, void* value) {
+    u32 mask = map->capacity - 1;
+
+    u32 pos = hash_map_hash(key) & mask;
+    while(map->states[pos] == SLOT_USED) {
+        pos = (pos + 1) & mask;
+    }
+
+    if(map->states[pos] == SLOT_EMPTY) {
+        map->used++;
+    }
+
+    map->keys[pos] = key;
+    map->values[pos] = value;
+    map->states[pos] = SLOT_USED;
+    map->size++;
+}
+
+static bool hash_map_rehash(hash_map* map, u32 capacity) {
+    u64* keys = (u64*) calloc(capacity, sizeof(u64));
+    void** values = (void**) calloc(capacity, sizeof(void*));
+    u8* states = (u8*) calloc(capacity, sizeof(u8));
+    if(keys == NULL || values == NULL || states == NULL) {
+        free(keys);
+        free(values);
+        free(states);
+        return false;
+    }
+
+    hash_map old = *map;
+
+    map->keys = keys;
+    map->values = values;
+    map->states = states;
+    map->size = 0;
+    map->used = 0;
+    map->capacity = capacity;
+
+    for(u32 i = 0; i < old.capacity; i++) {
+        if(old.states[i] == SLOT_USED) {
+            hash_map_insert(map, old.keys[i], old.values[i]);
+        }
+    }
+
+    free(old.keys);
+    free(old.values);
+    free(old.states);
+    return true;
+}
+
+bool hash_map_contains(hash_map* map, u64 key) {
+    return hash_map_find(map, key) != -1;
+}
+
+void* hash_map_get(hash_map* map, u64 key) {
+    int pos = hash_map_find(map, key);
+    return pos != -1 ? map->values[pos] : NULL;
+}
+
+bool hash_map_put(hash_map* map, u64 key, void* value) {
+    int pos = hash_map_find(map, key);
+    if(pos != -1) {
+        map->values[pos] = value;
+        return true;
+    }
+
+    if((map->used + 1) * 4 > map->capacity * 3 && !hash_map_rehash(map, hash_map_next_capacity(map->size, map->capacity))) {
+        return false;
+    }
+
+    hash_map_insert(map, key, value);
+    return true;
+}
+
+bool hash_map_remove(hash_map* map, u64 key) {
+    int pos = hash_map_find(map, key);
+    if(pos == -1) {
+        return false;
+    }
+
+    map->values[pos] = NULL;
+    map->states[pos] = SLOT_DELETED;
+    map->size--;
+    return true;
+}
+
+void string_map_init(string_map* map) {
+    memset(map, 0, sizeof(string_map));
+}
+
+void string_map_destroy(string_map* map) {
+    if(map->keys != NULL) {
+        free(map->keys);
+    }
+
+    if(map->hashes != NULL) {
+        free(map->hashes);
+    }
+
+    if(map->values != NULL) {
+        free(map->values);
+    }
+
+    if(map->states != NULL) {
+        free(map->states);
+    }
+
+    string_map_init(map);
+}
+
+u32 string_map_size(string_map* map) {
+    return map->size;
+}
+
+void string_map_clear(string_map* map) {
+    if(map->states != NULL) {
+        memset(map->states, SLOT_EMPTY, map->capacity);
+    }
+
+    map->size = 0;
+    map->used = 0;
+}
+
+static int string_map_find(string_map* map, const char* key, u32 hash) {
+    if(map->capacity == 0) {
+        return -1;
+    }
+
+    u32 mask = map->capacity - 1;
+    for(u32 pos = hash & mask; map->states[pos] != SLOT_EMPTY; pos = (pos + 1) & mask) {
+        if(map->states[pos] == SLOT_USED && map->hashes[pos] == hash && strcmp(map->keys[pos], key) == 0) {
+            return (int) pos;
+        }
+    }
+
+    return -1;
+}
+
+static void string_map_insert(string_map* map, const char* key, u32 hash, void* value) {
+    u32 mask = map->capacity - 1;
+
+    u32 pos = hash & mask;
+    while(map->states[pos] == SLOT_USED) {
+        pos = (pos + 1) & mask;
+    }
+
+    if(map->states[pos] == SLOT_EMPTY) {
+        map->used++;
+    }
+
+    map->keys[pos] = key;
+    map->hashes[pos] = hash;
+    map->values[pos] = value;
+    map->states[pos] = SLOT_USED;
+    map->size++;
+}
+
+static bool string_map_rehash(string_map* map, u32 capacity) {
+    const char** keys = (const char**) calloc(capacity, sizeof(const char*));
+    u32* hashes = (u32*) calloc(capacity, sizeof(u32));
+    void** values = (void**) calloc(capacity, sizeof(void*));
+    u8* states = (u8*) calloc(capacity, sizeof(u8));
+    if(keys == NULL || hashes == NULL || values == NULL || states == NULL) {
+        free(keys);
+        free(hashes);
+        free(values);
+        free(states);
+        return false;
+    }
+
+    string_map old = *map;
+
+    map->keys = keys;
+    map->hashes = hashes;
+    map->values = values;
+    map->states = states;
+    map->size = 0;
+    map->used = 0;
+    map->capacity = capacity;
+
+    for(u32 i = 0; i < old.capacity; i++) {
+        if(old.states[i] == SLOT_USED) {
+            string_map_insert(map, old.keys[i], old.hashes[i], old.values[i]);
+        }
+    }
+
+    free(old.keys);
+    free(old.hashes);
+    free(old.values);
+    free(old.states);
+    return true;
+}
+
+bool string_map_contains(string_map* map, const char* key) {
+    return string_map_find(map, key, string_map_hash(key)) != -1;
+}
+
+void* string_map_get(string_map* map, const char* key) {
+    int pos = string_map_find(map, key, string_map_hash(key));
+    return pos != -1 ? map->values[pos] : NULL;
+}
+
+bool string_map_put(string_map* map, const char* key, void* value) {
+    u32 hash = string_map_hash(key);
+
+    int pos = string_map_find(map, key, hash);
+    if(pos != -1) {
+        map->keys[pos] = key;
+        map->values[pos] = value;
+        return true;
+    }
+
+    if((map->used + 1) * 4 > map->capacity * 3 && !string_map_rehash(map, hash_map_next_capacity(map->size, map->capacity))) {
+        return false;
+    }
+
+    string_map_insert(map, key, hash, value);
+    return true;
+}
+
+bool string_map_remove(string_map* map, const char* key) {
+    int pos = string_map_find(map, key, string_map_hash(key));
+    if(pos == -1) {
+        return false;
+    }
+
+    map->keys[pos] = NULL;
+    map->values[pos] = NULL;
+    map->states[pos] = SLOT_DELETED;
+    map->size--;
+    return true;
+}
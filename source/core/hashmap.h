@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include <3ds.h>
+
+// Open addressing map from 64-bit keys, such as title IDs, to pointers.
+typedef struct hash_map_s {
+    u64* keys;
+    void** values;
+    u8* states;
+    u32 size;
+    u32 used;
+    u32 capacity;
+} hash_map;
+
+// Open addressing map from strings, such as paths, to pointers. Keys are not copied and must
+// outlive their entries.
+typedef struct string_map_s {
+    const char** keys;
+    u32* hashes;
+    void** values;
+    u8* states;
+    u32 size;
+    u32 used;
+    u32 capacity;
+} string_map;
+
+void hash_map_init(hash_map* map);
+void hash_map_destroy(hash_map* map);
+
+u32 hash_map_size(hash_map* map);
+void hash_map_clear(hash_map* map);
+bool hash_map_contains(hash_map* map, u64 key);
+void* hash_map_get(hash_map* map, u64 key);
+bool hash_map_put(hash_map* map, u64 key, void* value);
+bool hash_map_remove(hash_map* map, u64 key);
+
+void string_map_init(string_map* map);
+void string_map_destroy(string_map* map);
+
+u32 string_map_size(string_map* map);
+void string_map_clear(string_map* map);
+bool string_map_contains(string_map* map, const char* key);
+void* string_map_get(string_map* map, const char* key);
+bool string_map_put(string_map* map, const char* key, void* value);
+bool string_map_remove(string_map* map, const char* key);
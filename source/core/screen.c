@@ -2,12 +2,15 @@
 #include <malloc.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <3ds.h>
 #include <citro3d.h>
 
 #include "error.h"
+#include "glyphcache.h"
 #include "screen.h"
+#include "swizzle.h"
 #include "../libs/stb_image/stb_image.h"
 
 #include "default_shbin.h"
@@ -31,14 +34,142 @@ static u8 base_alpha = 0xFF;
 
 static u32 color_config[MAX_COLORS] = {0xFF000000};
 
+// Textures handed out by screen_allocate_free_texture are dynamic: their slots are recycled
+// through a free list, and while over the memory budget the least recently drawn ones are
+// evicted. An evicted texture keeps only its tiles in main memory and is uploaded again the
+// next time it is drawn. Slots are guarded by texture_lock, since populate threads load
+// textures while the main thread draws. Replaced textures may still be referenced by the
+// batch being built or by the GPU, so they are retired and deleted by the render thread at
+// the start of the next frame.
 static struct {
     bool allocated;
+    bool dynamic;
+    bool failed;
+    bool linearFilter;
+    bool atlas;
+    u8 atlasPage;
+    u8 atlasCell;
     C3D_Tex tex;
     u32 width;
     u32 height;
+    u32 lastUsed;
+    void* evicted;
+    u32 evictedSize;
+    GPU_TEXCOLOR evictedFormat;
+    bool evictedAtlas;
 } textures[MAX_TEXTURES];
 
+static LightLock texture_lock;
+static u16 free_textures[MAX_TEXTURES];
+static u32 free_texture_count;
+static u32 next_texture = 1;
+static bool placeholder_loaded;
+
+static u32 texture_memory;
+static u32 texture_budget = TEXTURE_BUDGET_DEFAULT;
+static u32 texture_evictions;
+static u32 frame_count;
+
+static C3D_Tex* retired_textures;
+static u32 retired_texture_count;
+static u32 retired_texture_capacity;
+
+// Small icons are packed into shared atlas pages of one format each, instead of padding
+// every icon out to its own 64x64 texture. Cells are tile aligned, so tiled icon data is
+// copied in a tile row at a time. Pages are flushed on the first draw after a change,
+// which batches the upload of icons loaded in between. Pages count against the texture
+// budget: the least recently drawn page is evicted whole, and a new page is refused when
+// eviction cannot make room for it, leaving icons to fall back to textures of their own.
+#define ATLAS_PAGE_SIZE 512
+#define ATLAS_CELL_SIZE 48
+#define ATLAS_CELLS_PER_ROW (ATLAS_PAGE_SIZE / ATLAS_CELL_SIZE)
+#define ATLAS_CELLS (ATLAS_CELLS_PER_ROW * ATLAS_CELLS_PER_ROW)
+#define MAX_ATLAS_PAGES 16
+
+static struct {
+    C3D_Tex tex;
+    u32 usedCells;
+    bool dirty;
+    u32 lastUsed;
+    u32 cells[(ATLAS_CELLS + 31) / 32];
+} atlas_pages[MAX_ATLAS_PAGES];
+
+static u32 atlas_binds_saved;
+
+// Quads are queued into a linear memory vertex buffer and drawn in batches that share a
+// texture and combiner state. The buffer is reset each frame, which is safe because
+// C3D_FRAME_SYNCDRAW waits for the previous frame's draws to complete.
+#define MAX_QUADS 8192
+
+typedef struct {
+    float x;
+    float y;
+    float z;
+    float u;
+    float v;
+} screen_vertex;
+
+static screen_vertex* vertices;
+static u16* indices;
+static u32 vertex_count;
+static u32 batch_start;
+
+// The bound texture is a copy, so slots replaced by other threads mid-frame leave queued
+// quads drawing from the retired texture.
+static C3D_Tex* batch_tex;
+static void* batch_tex_data;
+static C3D_Tex batch_tex_state;
+
+static bool blend_set;
+static u32 blend_color;
+static bool blend_rgb;
+static bool blend_alpha;
+
+static u32 frame_draw_calls;
+static u32 frame_vertices;
+static u32 last_frame_draw_calls;
+static u32 last_frame_vertices;
+
+static void screen_flush_batch() {
+    u32 count = vertex_count - batch_start;
+    if(count > 0) {
+        GSPGPU_FlushDataCache(&vertices[batch_start], count * sizeof(screen_vertex));
+        C3D_DrawElements(GPU_TRIANGLES, (int) (count / 4 * 6), C3D_UNSIGNED_SHORT, &indices[batch_start / 4 * 6]);
+
+        frame_draw_calls++;
+        frame_vertices += count;
+
+        batch_start = vertex_count;
+    }
+}
+
+static void screen_bind_texture(C3D_Tex* tex) {
+    if(tex != batch_tex || tex->data != batch_tex_data) {
+        screen_flush_batch();
+
+        batch_tex_state = *tex;
+        C3D_TexBind(0, &batch_tex_state);
+
+        batch_tex = tex;
+        batch_tex_data = tex->data;
+    }
+}
+
+static void screen_clear_text_layouts();
+static void screen_delete_retired_textures();
+
 static void screen_set_blend(u32 color, bool rgb, bool alpha) {
+    if(blend_set && color == blend_color && rgb == blend_rgb && alpha == blend_alpha) {
+        return;
+    }
+
+    screen_flush_batch();
+
+    blend_set = true;
+    blend_color = color;
+    blend_rgb = rgb;
+    blend_alpha = alpha;
+
     C3D_TexEnv* env = C3D_GetTexEnv(0);
     if(env == NULL) {
         error_panic("Failed to retrieve combiner settings.");
@@ -67,6 +198,8 @@ static void screen_set_blend(u32 color, bool rgb, bool alpha) {
 }
 
 void screen_init() {
+    LightLock_Init(&texture_lock);
+
     if(!C3D_Init(C3D_DEFAULT_CMDBUF_SIZE * 4)) {
         error_panic("Failed to initialize the GPU.");
         return;
@@ -127,6 +260,36 @@ void screen_init() {
     AttrInfo_AddLoader(attrInfo, 0, GPU_FLOAT, 3);
     AttrInfo_AddLoader(attrInfo, 1, GPU_FLOAT, 2);
 
+    vertices = (screen_vertex*) linearAlloc(MAX_QUADS * 4 * sizeof(screen_vertex));
+    indices = (u16*) linearAlloc(MAX_QUADS * 6 * sizeof(u16));
+    if(vertices == NULL || indices == NULL) {
+        error_panic("Failed to allocate vertex buffers.");
+        return;
+    }
+
+    for(u32 i = 0; i < MAX_QUADS; i++) {
+        u16* quad = &indices[i * 6];
+        u16 base = (u16) (i * 4);
+
+        quad[0] = base;
+        quad[1] = (u16) (base + 1);
+        quad[2] = (u16) (base + 2);
+        quad[3] = (u16) (base + 2);
+        quad[4] = (u16) (base + 1);
+        quad[5] = (u16) (base + 3);
+    }
+
+    GSPGPU_FlushDataCache(indices, MAX_QUADS * 6 * sizeof(u16));
+
+    C3D_BufInfo* bufInfo = C3D_GetBufInfo();
+    if(bufInfo == NULL) {
+        error_panic("Failed to retrieve buffer info.");
+        return;
+    }
+
+    BufInfo_Init(bufInfo);
+    BufInfo_Add(bufInfo, vertices, sizeof(screen_vertex), 2, 0x10);
+
     C3D_DepthTest(true, GPU_GEQUAL, GPU_WRITE_ALL);
 
     screen_set_blend(0, false, false);
@@ -157,13 +320,35 @@ void screen_init() {
     }
 
     font_scale = 30.0f / glyphInfo->cellHeight; // 30 is cellHeight in J machines
+
+    u32 placeholder[8 * 8];
+    for(u32 i = 0; i < 8 * 8; i++) {
+        placeholder[i] = 0x80808080;
+    }
+
+    screen_load_texture_untiled(TEXTURE_PLACEHOLDER, placeholder, sizeof(placeholder), 8, 8, GPU_RGBA8, false);
+    placeholder_loaded = true;
 }
 
 void screen_exit() {
+    placeholder_loaded = false;
+
     for(u32 id = 0; id < MAX_TEXTURES; id++) {
         screen_unload_texture(id);
     }
 
+    screen_delete_retired_textures();
+
+    if(retired_textures != NULL) {
+        free(retired_textures);
+        retired_textures = NULL;
+    }
+
+    retired_texture_capacity = 0;
+
+    screen_clear_text_layouts();
+    glyph_cache_clear();
+
     if(glyph_sheets != NULL) {
         free(glyph_sheets);
         glyph_sheets = NULL;
@@ -179,6 +364,16 @@ void screen_exit() {
         dvlb = NULL;
     }
 
+    if(vertices != NULL) {
+        linearFree(vertices);
+        vertices = NULL;
+    }
+
+    if(indices != NULL) {
+        linearFree(indices);
+        indices = NULL;
+    }
+
     if(target_top != NULL) {
         C3D_RenderTargetDelete(target_top);
         target_top = NULL;
@@ -220,29 +415,101 @@ static u32 screen_next_pow_2(u32 i) {
     return i;
 }
 
+static u32 screen_texture_format_bits(GPU_TEXCOLOR format) {
+    switch(format) {
+        case GPU_RGBA8:
+            return 32;
+        case GPU_RGB8:
+            return 24;
+        case GPU_RGBA5551:
+        case GPU_RGB565:
+        case GPU_RGBA4:
+        case GPU_LA8:
+        case GPU_HILO8:
+            return 16;
+        case GPU_L8:
+        case GPU_A8:
+        case GPU_LA4:
+        case GPU_ETC1A4:
+            return 8;
+        default:
+            return 4;
+    }
+}
+
+// Running out of slots is not fatal: callers get the shared placeholder, which ignores loads
+// and unloads.
 u32 screen_allocate_free_texture() {
-    u32 id = 0;
-    for(u32 i = 1; i < MAX_TEXTURES; i++) {
-        if(!textures[i].allocated) {
-            textures[i].allocated = true;
+    LightLock_Lock(&texture_lock);
 
-            id = i;
-            break;
+    u32 id = TEXTURE_PLACEHOLDER;
+    if(free_texture_count > 0) {
+        id = free_textures[--free_texture_count];
+    } else {
+        while(next_texture < MAX_TEXTURES && textures[next_texture].allocated) {
+            next_texture++;
+        }
+
+        if(next_texture < MAX_TEXTURES) {
+            id = next_texture++;
         }
     }
 
-    if(id == 0) {
-        error_panic("Out of free textures.");
-        return 0;
+    if(id != TEXTURE_PLACEHOLDER) {
+        textures[id].allocated = true;
+        textures[id].dynamic = true;
     }
 
+    LightLock_Unlock(&texture_lock);
+
     return id;
 }
 
-static void screen_prepare_texture(u32* pow2WidthOut, u32* pow2HeightOut, u32 id, u32 width, u32 height, GPU_TEXCOLOR format, bool linearFilter) {
+// Must be called with texture_lock held.
+static void screen_retire_texture(C3D_Tex* tex) {
+    texture_memory -= tex->size;
+
+    if(retired_texture_count == retired_texture_capacity) {
+        u32 capacity = retired_texture_capacity > 0 ? retired_texture_capacity * 2 : 64;
+
+        C3D_Tex* retired = (C3D_Tex*) realloc(retired_textures, capacity * sizeof(C3D_Tex));
+        if(retired == NULL) {
+            // Out of memory, so free it now rather than leak it.
+            C3D_TexDelete(tex);
+            tex->data = NULL;
+            return;
+        }
+
+        retired_textures = retired;
+        retired_texture_capacity = capacity;
+    }
+
+    retired_textures[retired_texture_count++] = *tex;
+    tex->data = NULL;
+}
+
+// Must be called with texture_lock held, while the GPU is not drawing.
+static void screen_delete_retired_textures() {
+    for(u32 i = 0; i < retired_texture_count; i++) {
+        C3D_TexDelete(&retired_textures[i]);
+    }
+
+    retired_texture_count = 0;
+}
+
+static void screen_evict_textures(u32 needed);
+static void screen_release_atlas_cell(u32 id);
+static void screen_copy_texture_atlas_in(u32 id, void* data, u32 size, u32 width, u32 height, GPU_TEXCOLOR format);
+
+// Must be called with texture_lock held. Returns false if the texture cannot take new contents.
+static bool screen_prepare_texture(u32* pow2WidthOut, u32* pow2HeightOut, u32 id, u32 width, u32 height, GPU_TEXCOLOR format, bool linearFilter) {
     if(id >= MAX_TEXTURES) {
         error_panic("Attempted to prepare invalid texture ID \"%lu\".", id);
-        return;
+        return false;
+    }
+
+    if(id == TEXTURE_PLACEHOLDER && placeholder_loaded) {
+        return false;
     }
 
     u32 pow2Width = screen_next_pow_2(width);
@@ -255,21 +522,51 @@ static void screen_prepare_texture(u32* pow2WidthOut, u32* pow2HeightOut, u32 id
         pow2Height = 64;
     }
 
+    if(textures[id].evicted != NULL) {
+        free(textures[id].evicted);
+        textures[id].evicted = NULL;
+    }
+
+    if(textures[id].atlas) {
+        screen_release_atlas_cell(id);
+    }
+
     if(textures[id].tex.data != NULL && (textures[id].tex.width != pow2Width || textures[id].tex.height != pow2Height || textures[id].tex.fmt != format)) {
-        C3D_TexDelete(&textures[id].tex);
-        textures[id].tex.data = NULL;
+        screen_retire_texture(&textures[id].tex);
     }
 
-    if(textures[id].tex.data == NULL && !C3D_TexInit(&textures[id].tex, (u16) pow2Width, (u16) pow2Height, format)) {
-        error_panic("Failed to initialize texture with ID \"%lu\".", id);
-        return;
+    if(textures[id].tex.data == NULL) {
+        screen_evict_textures(pow2Width * pow2Height * screen_texture_format_bits(format) / 8);
+
+        if(!C3D_TexInit(&textures[id].tex, (u16) pow2Width, (u16) pow2Height, format)) {
+            if(textures[id].dynamic) {
+                // Free whatever can be freed and try once more before falling back to the placeholder.
+                screen_evict_textures(texture_budget);
+
+                if(!C3D_TexInit(&textures[id].tex, (u16) pow2Width, (u16) pow2Height, format)) {
+                    textures[id].tex.data = NULL;
+                    textures[id].failed = true;
+                    textures[id].width = width;
+                    textures[id].height = height;
+                    return false;
+                }
+            } else {
+                error_panic("Failed to initialize texture with ID \"%lu\".", id);
+                return false;
+            }
+        }
+
+        texture_memory += textures[id].tex.size;
     }
 
     C3D_TexSetFilter(&textures[id].tex, linearFilter ? GPU_LINEAR : GPU_NEAREST, GPU_NEAREST);
 
     textures[id].allocated = true;
+    textures[id].failed = false;
+    textures[id].linearFilter = linearFilter;
     textures[id].width = width;
     textures[id].height = height;
+    textures[id].lastUsed = frame_count;
 
     if(pow2WidthOut != NULL) {
         *pow2WidthOut = pow2Width;
@@ -278,22 +575,30 @@ static void screen_prepare_texture(u32* pow2WidthOut, u32* pow2HeightOut, u32 id
     if(pow2HeightOut != NULL) {
         *pow2HeightOut = pow2Height;
     }
+
+    return true;
 }
 
-void screen_load_texture_tiled(u32 id, void* data, u32 size, u32 width, u32 height, GPU_TEXCOLOR format, bool linearFilter) {
+static void screen_copy_texture_tiled_in(u32 id, void* data, u32 size, u32 width, u32 height, GPU_TEXCOLOR format, bool linearFilter) {
     u32 pow2Width = 0;
     u32 pow2Height = 0;
-    screen_prepare_texture(&pow2Width, &pow2Height, id, width, height, format, linearFilter);
+    if(!screen_prepare_texture(&pow2Width, &pow2Height, id, width, height, format, linearFilter)) {
+        return;
+    }
 
-    if(width != pow2Width || height != pow2Height) {
-        u32 pixelSize = size / width / height;
+    // Tiled data covers whole 8x8 tiles, so partial tiles at the edges are padded out.
+    u32 tiledWidth = (width + 7) & ~7;
+    u32 tiledHeight = (height + 7) & ~7;
+
+    if(tiledWidth != pow2Width || tiledHeight != pow2Height) {
+        u32 pixelSize = size / tiledWidth / tiledHeight;
 
         memset(textures[id].tex.data, 0, textures[id].tex.size);
-        for(u32 y = 0; y < height; y += 8) {
+        for(u32 y = 0; y < tiledHeight; y += 8) {
             u32 dstPos = y * pow2Width * pixelSize;
-            u32 srcPos = y * width * pixelSize;
+            u32 srcPos = y * tiledWidth * pixelSize;
 
-            memcpy(&((u8*) textures[id].tex.data)[dstPos], &((u8*) data)[srcPos], width * 8 * pixelSize);
+            memcpy(&((u8*) textures[id].tex.data)[dstPos], &((u8*) data)[srcPos], tiledWidth * 8 * pixelSize);
         }
     } else {
         memcpy(textures[id].tex.data, data, textures[id].tex.size);
@@ -302,24 +607,356 @@ void screen_load_texture_tiled(u32 id, void* data, u32 size, u32 width, u32 heig
     C3D_TexFlush(&textures[id].tex);
 }
 
+void screen_load_texture_tiled(u32 id, void* data, u32 size, u32 width, u32 height, GPU_TEXCOLOR format, bool linearFilter) {
+    LightLock_Lock(&texture_lock);
+    screen_copy_texture_tiled_in(id, data, size, width, height, format, linearFilter);
+    LightLock_Unlock(&texture_lock);
+}
+
+static u32 screen_get_texture_tiled_size(u32 id) {
+    u32 tiledWidth = (textures[id].width + 7) & ~7;
+    u32 tiledHeight = (textures[id].height + 7) & ~7;
+    u32 pixelSize = textures[id].tex.size / textures[id].tex.width / textures[id].tex.height;
+
+    return tiledWidth * tiledHeight * pixelSize;
+}
+
+static void screen_copy_texture_tiled_out(u32 id, void* data) {
+    u32 tiledWidth = (textures[id].width + 7) & ~7;
+    u32 tiledHeight = (textures[id].height + 7) & ~7;
+    u32 pixelSize = textures[id].tex.size / textures[id].tex.width / textures[id].tex.height;
+
+    for(u32 y = 0; y < tiledHeight; y += 8) {
+        u32 dstPos = y * tiledWidth * pixelSize;
+        u32 srcPos = y * textures[id].tex.width * pixelSize;
+
+        memcpy(&((u8*) data)[dstPos], &((u8*) textures[id].tex.data)[srcPos], tiledWidth * 8 * pixelSize);
+    }
+}
+
+// Copies out the tiles covering a texture's image, in the layout screen_load_texture_tiled takes.
+bool screen_get_texture_tiled(u32 id, void* data, u32 size) {
+    if(id >= MAX_TEXTURES) {
+        return false;
+    }
+
+    LightLock_Lock(&texture_lock);
+
+    bool copied = false;
+    if(textures[id].tex.data != NULL && size == screen_get_texture_tiled_size(id)) {
+        screen_copy_texture_tiled_out(id, data);
+        copied = true;
+    } else if(textures[id].evicted != NULL && size == textures[id].evictedSize) {
+        memcpy(data, textures[id].evicted, size);
+        copied = true;
+    }
+
+    LightLock_Unlock(&texture_lock);
+
+    return copied;
+}
+
+static bool screen_evict_texture(u32 id) {
+    u32 size = screen_get_texture_tiled_size(id);
+
+    void* evicted = malloc(size);
+    if(evicted == NULL) {
+        return false;
+    }
+
+    screen_copy_texture_tiled_out(id, evicted);
+
+    textures[id].evicted = evicted;
+    textures[id].evictedSize = size;
+    textures[id].evictedFormat = textures[id].tex.fmt;
+    textures[id].evictedAtlas = false;
+
+    screen_retire_texture(&textures[id].tex);
+
+    texture_evictions++;
+    return true;
+}
+
+// Evicts every icon in an atlas page, which retires the page once its last cell is released.
+static bool screen_evict_atlas_page(u32 page) {
+    u32 pixelSize = atlas_pages[page].tex.size / ATLAS_PAGE_SIZE / ATLAS_PAGE_SIZE;
+    GPU_TEXCOLOR format = atlas_pages[page].tex.fmt;
+
+    for(u32 id = 1; id < MAX_TEXTURES && atlas_pages[page].tex.data != NULL; id++) {
+        if(!textures[id].atlas || textures[id].atlasPage != page || !textures[id].dynamic) {
+            continue;
+        }
+
+        u32 tiledWidth = (textures[id].width + 7) & ~7;
+        u32 tiledHeight = (textures[id].height + 7) & ~7;
+        u32 tileRowSize = tiledWidth * 8 * pixelSize;
+
+        u8* evicted = (u8*) malloc(tiledHeight / 8 * tileRowSize);
+        if(evicted == NULL) {
+            return false;
+        }
+
+        u32 cellX = (textures[id].atlasCell % ATLAS_CELLS_PER_ROW) * ATLAS_CELL_SIZE;
+        u32 cellY = (textures[id].atlasCell / ATLAS_CELLS_PER_ROW) * ATLAS_CELL_SIZE;
+
+        u8* data = (u8*) atlas_pages[page].tex.data;
+        for(u32 y = 0; y < tiledHeight; y += 8) {
+            memcpy(&evicted[y / 8 * tileRowSize], &data[((cellY + y) * ATLAS_PAGE_SIZE + cellX * 8) * pixelSize], tileRowSize);
+        }
+
+        textures[id].evicted = evicted;
+        textures[id].evictedSize = tiledHeight / 8 * tileRowSize;
+        textures[id].evictedFormat = format;
+        textures[id].evictedAtlas = true;
+
+        screen_release_atlas_cell(id);
+
+        texture_evictions++;
+    }
+
+    return atlas_pages[page].tex.data == NULL;
+}
+
+// Evicts dynamic textures and atlas pages, least recently drawn first, until needed more bytes
+// fit in the budget. Anything drawn in the current frame may still be read by the GPU and is kept.
+static void screen_evict_textures(u32 needed) {
+    while(texture_memory + needed > texture_budget) {
+        u32 oldest = 0;
+        for(u32 id = 1; id < MAX_TEXTURES; id++) {
+            if(textures[id].dynamic && textures[id].tex.data != NULL && textures[id].lastUsed != frame_count
+               && (oldest == 0 || frame_count - textures[id].lastUsed > frame_count - textures[oldest].lastUsed)) {
+                oldest = id;
+            }
+        }
+
+        u32 oldestPage = MAX_ATLAS_PAGES;
+        for(u32 page = 0; page < MAX_ATLAS_PAGES; page++) {
+            if(atlas_pages[page].tex.data != NULL && atlas_pages[page].lastUsed != frame_count
+               && (oldestPage == MAX_ATLAS_PAGES || frame_count - atlas_pages[page].lastUsed > frame_count - atlas_pages[oldestPage].lastUsed)) {
+                oldestPage = page;
+            }
+        }
+
+        if(oldestPage != MAX_ATLAS_PAGES && (oldest == 0 || frame_count - atlas_pages[oldestPage].lastUsed > frame_count - textures[oldest].lastUsed)) {
+            if(!screen_evict_atlas_page(oldestPage)) {
+                break;
+            }
+        } else if(oldest == 0 || !screen_evict_texture(oldest)) {
+            break;
+        }
+    }
+}
+
+// Must be called with texture_lock held. Uploads an evicted texture again.
+static void screen_restore_texture(u32 id) {
+    void* evicted = textures[id].evicted;
+    textures[id].evicted = NULL;
+
+    if(textures[id].evictedAtlas) {
+        screen_copy_texture_atlas_in(id, evicted, textures[id].evictedSize, textures[id].width, textures[id].height, textures[id].evictedFormat);
+    } else {
+        screen_copy_texture_tiled_in(id, evicted, textures[id].evictedSize, textures[id].width, textures[id].height, textures[id].evictedFormat, textures[id].linearFilter);
+    }
+
+    free(evicted);
+}
+
+static void screen_release_atlas_cell(u32 id) {
+    u32 page = textures[id].atlasPage;
+    u32 cell = textures[id].atlasCell;
+
+    textures[id].atlas = false;
+
+    atlas_pages[page].cells[cell / 32] &= ~(1 << (cell % 32));
+    if(--atlas_pages[page].usedCells == 0) {
+        screen_retire_texture(&atlas_pages[page].tex);
+    }
+}
+
+static bool screen_allocate_atlas_cell(u8* pageOut, u8* cellOut, GPU_TEXCOLOR format) {
+    u32 page = MAX_ATLAS_PAGES;
+    for(u32 i = 0; i < MAX_ATLAS_PAGES; i++) {
+        if(atlas_pages[i].tex.data != NULL && atlas_pages[i].tex.fmt == format && atlas_pages[i].usedCells < ATLAS_CELLS) {
+            page = i;
+            break;
+        }
+    }
+
+    if(page == MAX_ATLAS_PAGES) {
+        for(u32 i = 0; i < MAX_ATLAS_PAGES; i++) {
+            if(atlas_pages[i].tex.data == NULL) {
+                page = i;
+                break;
+            }
+        }
+
+        if(page == MAX_ATLAS_PAGES) {
+            return false;
+        }
+
+        u32 pageSize = ATLAS_PAGE_SIZE * ATLAS_PAGE_SIZE * screen_texture_format_bits(format) / 8;
+
+        screen_evict_textures(pageSize);
+        if(texture_memory + pageSize > texture_budget) {
+            return false;
+        }
+
+        if(!C3D_TexInit(&atlas_pages[page].tex, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, format)) {
+            atlas_pages[page].tex.data = NULL;
+            return false;
+        }
+
+        C3D_TexSetFilter(&atlas_pages[page].tex, GPU_NEAREST, GPU_NEAREST);
+
+        texture_memory += atlas_pages[page].tex.size;
+
+        atlas_pages[page].usedCells = 0;
+        atlas_pages[page].dirty = false;
+        atlas_pages[page].lastUsed = frame_count;
+        memset(atlas_pages[page].cells, 0, sizeof(atlas_pages[page].cells));
+    }
+
+    u32 cell = 0;
+    while(atlas_pages[page].cells[cell / 32] & (1 << (cell % 32))) {
+        cell++;
+    }
+
+    atlas_pages[page].cells[cell / 32] |= 1 << (cell % 32);
+    atlas_pages[page].usedCells++;
+
+    *pageOut = (u8) page;
+    *cellOut = (u8) cell;
+    return true;
+}
+
+// Must be called with texture_lock held.
+static void screen_copy_texture_atlas_in(u32 id, void* data, u32 size, u32 width, u32 height, GPU_TEXCOLOR format) {
+    if(width > ATLAS_CELL_SIZE || height > ATLAS_CELL_SIZE) {
+        screen_copy_texture_tiled_in(id, data, size, width, height, format, false);
+        return;
+    }
+
+    if(textures[id].atlas && atlas_pages[textures[id].atlasPage].tex.fmt != format) {
+        screen_release_atlas_cell(id);
+    }
+
+    if(!textures[id].atlas) {
+        if(!screen_allocate_atlas_cell(&textures[id].atlasPage, &textures[id].atlasCell, format)) {
+            screen_copy_texture_tiled_in(id, data, size, width, height, format, false);
+            return;
+        }
+
+        textures[id].atlas = true;
+    }
+
+    if(textures[id].tex.data != NULL) {
+        screen_retire_texture(&textures[id].tex);
+    }
+
+    if(textures[id].evicted != NULL) {
+        free(textures[id].evicted);
+        textures[id].evicted = NULL;
+    }
+
+    u32 tiledWidth = (width + 7) & ~7;
+    u32 tiledHeight = (height + 7) & ~7;
+    u32 pixelSize = size / tiledWidth / tiledHeight;
+    u32 tileRowSize = tiledWidth * 8 * pixelSize;
+
+    u32 cellX = (textures[id].atlasCell % ATLAS_CELLS_PER_ROW) * ATLAS_CELL_SIZE;
+    u32 cellY = (textures[id].atlasCell / ATLAS_CELLS_PER_ROW) * ATLAS_CELL_SIZE;
+
+    u8* page = (u8*) atlas_pages[textures[id].atlasPage].tex.data;
+    for(u32 y = 0; y < tiledHeight; y += 8) {
+        memcpy(&page[((cellY + y) * ATLAS_PAGE_SIZE + cellX * 8) * pixelSize], &((u8*) data)[y / 8 * tileRowSize], tileRowSize);
+    }
+
+    atlas_pages[textures[id].atlasPage].dirty = true;
+    atlas_pages[textures[id].atlasPage].lastUsed = frame_count;
+
+    textures[id].allocated = true;
+    textures[id].failed = false;
+    textures[id].linearFilter = false;
+    textures[id].width = width;
+    textures[id].height = height;
+    textures[id].lastUsed = frame_count;
+}
+
+// Loads tiled data like screen_load_texture_tiled, but into a cell of a shared atlas page
+// when it fits, falling back to a texture of its own otherwise.
+void screen_load_texture_atlas(u32 id, void* data, u32 size, u32 width, u32 height, GPU_TEXCOLOR format) {
+    if(id >= MAX_TEXTURES) {
+        error_panic("Attempted to load atlas texture to invalid texture ID \"%lu\".", id);
+        return;
+    }
+
+    LightLock_Lock(&texture_lock);
+
+    if(id != TEXTURE_PLACEHOLDER || !placeholder_loaded) {
+        screen_copy_texture_atlas_in(id, data, size, width, height, format);
+    }
+
+    LightLock_Unlock(&texture_lock);
+}
+
+void screen_get_atlas_stats(u32* pages, u32* usedCells, u32* totalCells, u32* bindsSaved) {
+    LightLock_Lock(&texture_lock);
+
+    u32 pageCount = 0;
+    u32 cellCount = 0;
+    for(u32 i = 0; i < MAX_ATLAS_PAGES; i++) {
+        if(atlas_pages[i].tex.data != NULL) {
+            pageCount++;
+            cellCount += atlas_pages[i].usedCells;
+        }
+    }
+
+    LightLock_Unlock(&texture_lock);
+
+    if(pages != NULL) {
+        *pages = pageCount;
+    }
+
+    if(usedCells != NULL) {
+        *usedCells = cellCount;
+    }
+
+    if(totalCells != NULL) {
+        *totalCells = pageCount * ATLAS_CELLS;
+    }
+
+    if(bindsSaved != NULL) {
+        *bindsSaved = atlas_binds_saved;
+    }
+}
+
 void screen_load_texture_untiled(u32 id, void* data, u32 size, u32 width, u32 height, GPU_TEXCOLOR format, bool linearFilter) {
+    LightLock_Lock(&texture_lock);
+
     u32 pow2Width = 0;
     u32 pow2Height = 0;
-    screen_prepare_texture(&pow2Width, &pow2Height, id, width, height, format, linearFilter);
+    if(!screen_prepare_texture(&pow2Width, &pow2Height, id, width, height, format, linearFilter)) {
+        LightLock_Unlock(&texture_lock);
+        return;
+    }
 
     u32 pixelSize = size / width / height;
 
-    memset(textures[id].tex.data, 0, textures[id].tex.size);
-    for(u32 x = 0; x < width; x++) {
-        for(u32 y = 0; y < height; y++) {
-            u32 dstPos = ((((y >> 3) * (pow2Width >> 3) + (x >> 3)) << 6) + ((x & 1) | ((y & 1) << 1) | ((x & 2) << 1) | ((y & 2) << 2) | ((x & 4) << 2) | ((y & 4) << 3))) * pixelSize;
-            u32 srcPos = (y * width + x) * pixelSize;
+    if(width != pow2Width || height != pow2Height) {
+        memset(textures[id].tex.data, 0, textures[id].tex.size);
+    }
 
-            memcpy(&((u8*) textures[id].tex.data)[dstPos], &((u8*) data)[srcPos], pixelSize);
-        }
+    if(pixelSize == 2 && ((u32) data & 1) == 0) {
+        screen_swizzle_16((u16*) textures[id].tex.data, (const u16*) data, width, height, pow2Width);
+    } else if(pixelSize == 4 && ((u32) data & 3) == 0) {
+        screen_swizzle_32((u32*) textures[id].tex.data, (const u32*) data, width, height, pow2Width);
+    } else {
+        screen_swizzle_generic((u8*) textures[id].tex.data, (const u8*) data, width, height, pow2Width, pixelSize);
     }
 
     C3D_TexFlush(&textures[id].tex);
+
+    LightLock_Unlock(&texture_lock);
 }
 
 void screen_load_texture_path(u32 id, const char* path, bool linearFilter) {
@@ -355,23 +992,26 @@ void screen_load_texture_file(u32 id, FILE* fd, bool linearFilter) {
         return;
     }
 
-    for(u32 x = 0; x < width; x++) {
-        for(u32 y = 0; y < height; y++) {
-            u32 pos = (y * width + x) * 4;
+    LightLock_Lock(&texture_lock);
 
-            u8 c1 = image[pos + 0];
-            u8 c2 = image[pos + 1];
-            u8 c3 = image[pos + 2];
-            u8 c4 = image[pos + 3];
+    u32 pow2Width = 0;
+    u32 pow2Height = 0;
+    if(!screen_prepare_texture(&pow2Width, &pow2Height, id, (u32) width, (u32) height, GPU_RGBA8, linearFilter)) {
+        LightLock_Unlock(&texture_lock);
 
-            image[pos + 0] = c4;
-            image[pos + 1] = c3;
-            image[pos + 2] = c2;
-            image[pos + 3] = c1;
-        }
+        free(image);
+        return;
+    }
+
+    if((u32) width != pow2Width || (u32) height != pow2Height) {
+        memset(textures[id].tex.data, 0, textures[id].tex.size);
     }
 
-    screen_load_texture_untiled(id, image, (u32) (width * height * 4), (u32) width, (u32) height, GPU_RGBA8, linearFilter);
+    screen_swizzle_rgba_to_abgr((u32*) textures[id].tex.data, (const u32*) image, (u32) width, (u32) height, pow2Width);
+
+    C3D_TexFlush(&textures[id].tex);
+
+    LightLock_Unlock(&texture_lock);
 
     free(image);
 }
@@ -382,12 +1022,36 @@ void screen_unload_texture(u32 id) {
         return;
     }
 
-    C3D_TexDelete(&textures[id].tex);
-    textures[id].tex.data = NULL;
+    if(id == TEXTURE_PLACEHOLDER && placeholder_loaded) {
+        return;
+    }
+
+    LightLock_Lock(&texture_lock);
+
+    if(textures[id].tex.data != NULL) {
+        screen_retire_texture(&textures[id].tex);
+    }
+
+    if(textures[id].evicted != NULL) {
+        free(textures[id].evicted);
+        textures[id].evicted = NULL;
+    }
+
+    if(textures[id].atlas) {
+        screen_release_atlas_cell(id);
+    }
+
+    if(textures[id].dynamic) {
+        free_textures[free_texture_count++] = (u16) id;
+    }
 
     textures[id].allocated = false;
+    textures[id].dynamic = false;
+    textures[id].failed = false;
     textures[id].width = 0;
     textures[id].height = 0;
+
+    LightLock_Unlock(&texture_lock);
 }
 
 void screen_get_texture_size(u32* width, u32* height, u32 id) {
@@ -405,18 +1069,73 @@ void screen_get_texture_size(u32* width, u32* height, u32 id) {
     }
 }
 
+void screen_set_texture_budget(u32 budget) {
+    LightLock_Lock(&texture_lock);
+
+    texture_budget = budget;
+    screen_evict_textures(0);
+
+    LightLock_Unlock(&texture_lock);
+}
+
+void screen_get_texture_stats(u32* memory, u32* budget, u32* evictions) {
+    if(memory != NULL) {
+        *memory = texture_memory;
+    }
+
+    if(budget != NULL) {
+        *budget = texture_budget;
+    }
+
+    if(evictions != NULL) {
+        *evictions = texture_evictions;
+    }
+}
+
 void screen_begin_frame() {
     if(!C3D_FrameBegin(C3D_FRAME_SYNCDRAW)) {
         error_panic("Failed to begin frame.");
         return;
     }
+
+    // The previous frame has finished drawing, so textures retired since are no longer read.
+    LightLock_Lock(&texture_lock);
+    screen_delete_retired_textures();
+    LightLock_Unlock(&texture_lock);
+
+    batch_tex = NULL;
+    batch_tex_data = NULL;
+    frame_count++;
+
+    vertex_count = 0;
+    batch_start = 0;
+
+    frame_draw_calls = 0;
+    frame_vertices = 0;
 }
 
 void screen_end_frame() {
+    screen_flush_batch();
+
     C3D_FrameEnd(0);
+
+    last_frame_draw_calls = frame_draw_calls;
+    last_frame_vertices = frame_vertices;
+}
+
+void screen_get_frame_stats(u32* drawCalls, u32* vertexCount) {
+    if(drawCalls != NULL) {
+        *drawCalls = last_frame_draw_calls;
+    }
+
+    if(vertexCount != NULL) {
+        *vertexCount = last_frame_vertices;
+    }
 }
 
 void screen_select(gfxScreen_t screen) {
+    screen_flush_batch();
+
     C3D_RenderTarget* target = screen == GFX_TOP ? target_top : target_bottom;
 
     C3D_RenderTargetClear(target, C3D_CLEAR_ALL, 0, 0);
@@ -429,21 +1148,55 @@ void screen_select(gfxScreen_t screen) {
 }
 
 static void screen_draw_quad(float x1, float y1, float x2, float y2, float left, float bottom, float right, float top) {
-    C3D_ImmDrawBegin(GPU_TRIANGLE_STRIP);
+    // Quads past the end of the buffer are dropped for the rest of the frame.
+    if(vertex_count + 4 > MAX_QUADS * 4) {
+        return;
+    }
+
+    screen_vertex* quad = &vertices[vertex_count];
+
+    quad[0] = (screen_vertex) {x1, y2, 0.5f, left, bottom};
+    quad[1] = (screen_vertex) {x2, y2, 0.5f, right, bottom};
+    quad[2] = (screen_vertex) {x1, y1, 0.5f, left, top};
+    quad[3] = (screen_vertex) {x2, y1, 0.5f, right, top};
+
+    vertex_count += 4;
+}
+
+// Must be called with texture_lock held. Resolves the slot to draw in place of *id, returning
+// the texture to bind and the image's offset within it in pixels from the top left.
+static C3D_Tex* screen_use_texture(u32* id, u32* originX, u32* originY) {
+    if(textures[*id].evicted != NULL) {
+        screen_restore_texture(*id);
+    }
 
-    C3D_ImmSendAttrib(x1, y2, 0.5f, 0.0f);
-    C3D_ImmSendAttrib(left, bottom, 0.0f, 0.0f);
+    if(textures[*id].failed && placeholder_loaded) {
+        *id = TEXTURE_PLACEHOLDER;
+    }
 
-    C3D_ImmSendAttrib(x2, y2, 0.5f, 0.0f);
-    C3D_ImmSendAttrib(right, bottom, 0.0f, 0.0f);
+    textures[*id].lastUsed = frame_count;
 
-    C3D_ImmSendAttrib(x1, y1, 0.5f, 0.0f);
-    C3D_ImmSendAttrib(left, top, 0.0f, 0.0f);
+    if(textures[*id].atlas) {
+        u32 page = textures[*id].atlasPage;
+        atlas_pages[page].lastUsed = frame_count;
 
-    C3D_ImmSendAttrib(x2, y1, 0.5f, 0.0f);
-    C3D_ImmSendAttrib(right, top, 0.0f, 0.0f);
+        if(atlas_pages[page].dirty) {
+            C3D_TexFlush(&atlas_pages[page].tex);
+            atlas_pages[page].dirty = false;
+        }
+
+        if(batch_tex == &atlas_pages[page].tex) {
+            atlas_binds_saved++;
+        }
 
-    C3D_ImmDrawEnd();
+        *originX = (textures[*id].atlasCell % ATLAS_CELLS_PER_ROW) * ATLAS_CELL_SIZE;
+        *originY = (textures[*id].atlasCell / ATLAS_CELLS_PER_ROW) * ATLAS_CELL_SIZE;
+        return &atlas_pages[page].tex;
+    }
+
+    *originX = 0;
+    *originY = 0;
+    return textures[*id].tex.data != NULL ? &textures[*id].tex : NULL;
 }
 
 void screen_draw_texture(u32 id, float x, float y, float width, float height) {
@@ -452,20 +1205,29 @@ void screen_draw_texture(u32 id, float x, float y, float width, float height) {
         return;
     }
 
-    if(textures[id].tex.data == NULL) {
+    LightLock_Lock(&texture_lock);
+
+    u32 originX = 0;
+    u32 originY = 0;
+    C3D_Tex* tex = screen_use_texture(&id, &originX, &originY);
+    if(tex == NULL) {
+        LightLock_Unlock(&texture_lock);
         return;
     }
 
     if(base_alpha != 0xFF) {
         screen_set_blend(base_alpha << 24, false, true);
+    } else {
+        screen_set_blend(0, false, false);
     }
 
-    C3D_TexBind(0, &textures[id].tex);
-    screen_draw_quad(x, y, x + width, y + height, 0, (float) (textures[id].tex.height - textures[id].height) / (float) textures[id].tex.height, (float) textures[id].width / (float) textures[id].tex.width, 1.0f);
+    float texWidth = tex->width;
+    float texHeight = tex->height;
 
-    if(base_alpha != 0xFF) {
-        screen_set_blend(0, false, false);
-    }
+    screen_bind_texture(tex);
+    screen_draw_quad(x, y, x + width, y + height, originX / texWidth, 1.0f - (originY + textures[id].height) / texHeight, (originX + textures[id].width) / texWidth, 1.0f - originY / texHeight);
+
+    LightLock_Unlock(&texture_lock);
 }
 
 void screen_draw_texture_crop(u32 id, float x, float y, float width, float height) {
@@ -474,20 +1236,29 @@ void screen_draw_texture_crop(u32 id, float x, float y, float width, float heigh
         return;
     }
 
-    if(textures[id].tex.data == NULL) {
+    LightLock_Lock(&texture_lock);
+
+    u32 originX = 0;
+    u32 originY = 0;
+    C3D_Tex* tex = screen_use_texture(&id, &originX, &originY);
+    if(tex == NULL) {
+        LightLock_Unlock(&texture_lock);
         return;
     }
 
     if(base_alpha != 0xFF) {
         screen_set_blend(base_alpha << 24, false, true);
+    } else {
+        screen_set_blend(0, false, false);
     }
 
-    C3D_TexBind(0, &textures[id].tex);
-    screen_draw_quad(x, y, x + width, y + height, 0, (float) (textures[id].tex.height - textures[id].height) / (float) textures[id].tex.height, width / (float) textures[id].tex.width, (textures[id].tex.height - textures[id].height + height) / (float) textures[id].tex.height);
+    float texWidth = tex->width;
+    float texHeight = tex->height;
 
-    if(base_alpha != 0xFF) {
-        screen_set_blend(0, false, false);
-    }
+    screen_bind_texture(tex);
+    screen_draw_quad(x, y, x + width, y + height, originX / texWidth, 1.0f - (originY + textures[id].height) / texHeight, (originX + width) / texWidth, 1.0f - (originY + textures[id].height - height) / texHeight);
+
+    LightLock_Unlock(&texture_lock);
 }
 
 float screen_get_font_height(float scaleY) {
@@ -558,7 +1329,7 @@ static void screen_wrap_string(u32* lines, float* lineWidths, float* lineHeights
             lastAlignPos = linePos;
         }
 
-        charWidth *= scaleX * fontGetCharWidthInfo(NULL, fontGlyphIndexFromCodePoint(NULL, code))->charWidth;
+        charWidth *= scaleX * glyph_cache_get(code)->charWidth;
 
         if(code == '\n' || (wordWrap && lw + charWidth >= maxWidth)) {
             if(code == '\n') {
@@ -625,59 +1396,83 @@ static void screen_wrap_string(u32* lines, float* lineWidths, float* lineHeights
     }
 }
 
-void screen_get_string_size(float* width, float* height, const char* text, float scaleX, float scaleY) {
-    screen_wrap_string(NULL, NULL, NULL, NULL, width, height, text, 0, 0, scaleX, scaleY, false);
-}
+// Laid out strings are cached by text, scale and wrap width, so static text drawn every
+// frame skips line wrapping and glyph lookups. Glyph quads are stored relative to the
+// string's origin and line centering is applied at draw time.
+#define MAX_TEXT_LAYOUTS 128
+
+typedef struct {
+    u32 sheet;
+    u32 line;
+    float x1;
+    float y1;
+    float x2;
+    float y2;
+    float left;
+    float bottom;
+    float right;
+    float top;
+} screen_glyph_quad;
+
+typedef struct {
+    char* text;
+    u32 hash;
+    float scaleX;
+    float scaleY;
+    bool wrap;
+    float wrapWidth;
+    u32 lastUsed;
+
+    u32 numLines;
+    float lineWidths[MAX_LINES];
+    float totalWidth;
+    float totalHeight;
 
-void screen_get_string_size_wrap(float* width, float* height, const char* text, float scaleX, float scaleY, float wrapWidth) {
-    screen_wrap_string(NULL, NULL, NULL, NULL, width, height, text, 0, wrapWidth, scaleX, scaleY, true);
-}
+    screen_glyph_quad* quads;
+    u32 quadCount;
+} screen_text_layout;
 
-static void screen_draw_string_internal(const char* text, float x, float y, float scaleX, float scaleY, u32 colorId, bool centerLines, bool wrap, float wrapX) {
-    if(text == NULL) {
-        return;
+static screen_text_layout text_layouts[MAX_TEXT_LAYOUTS];
+static u32 text_layout_tick;
+static u32 text_layout_hits;
+static u32 text_layout_misses;
+
+static void screen_free_text_layout(screen_text_layout* layout) {
+    if(layout->text != NULL) {
+        free(layout->text);
     }
 
-    if(colorId >= MAX_COLORS) {
-        error_panic("Attempted to draw string with invalid color ID \"%lu\".", colorId);
-        return;
+    if(layout->quads != NULL) {
+        free(layout->quads);
     }
 
-    u32 blendColor = color_config[colorId];
-    if(base_alpha != 0xFF) {
-        float alpha1 = ((blendColor >> 24) & 0xFF) / 255.0f;
-        float alpha2 = base_alpha / 255.0f;
-        float blendedAlpha = alpha1 * alpha2;
+    memset(layout, 0, sizeof(screen_text_layout));
+}
 
-        blendColor = (((u32) (blendedAlpha * 0xFF)) << 24) | (blendColor & 0x00FFFFFF);
+static void screen_clear_text_layouts() {
+    for(u32 i = 0; i < MAX_TEXT_LAYOUTS; i++) {
+        screen_free_text_layout(&text_layouts[i]);
     }
+}
 
-    screen_set_blend(blendColor, true, true);
-
+static bool screen_build_text_layout(screen_text_layout* layout, const char* text, float scaleX, float scaleY, bool wrap, float wrapWidth) {
     u32 lines[MAX_LINES];
-    float lineWidths[MAX_LINES];
     float lineHeights[MAX_LINES];
-    u32 numLines = 0;
-    float totalWidth = 0;
-    float totalHeight = 0;
-    screen_wrap_string(lines, lineWidths, lineHeights, &numLines, &totalWidth, &totalHeight, text, MAX_LINES, wrapX - x, scaleX, scaleY, wrap);
+    screen_wrap_string(lines, layout->lineWidths, lineHeights, &layout->numLines, &layout->totalWidth, &layout->totalHeight, text, MAX_LINES, wrapWidth, scaleX, scaleY, wrap);
+
+    u32 capacity = 0;
 
-    float currX = x;
-    float currY = y;
+    float currY = 0;
 
     u32 linePos = 0;
     u32 lastAlignPos = 0;
-    int lastSheet = -1;
 
     const uint8_t* p = (const uint8_t*) text;
     u32 code = 0;
     ssize_t units = -1;
 
-    for(u32 i = 0; i < numLines; i++) {
-        currX = x;
-        if(centerLines) {
-            currX += (totalWidth - lineWidths[i]) / 2;
-        }
+    for(u32 i = 0; i < layout->numLines; i++) {
+        float currX = 0;
 
         while(linePos < lines[i] && *p && (units = decode_utf8(&code, p)) != -1 && code > 0) {
             p += units;
@@ -691,22 +1486,36 @@ static void screen_draw_string_internal(const char* text, float x, float y, floa
                     lastAlignPos = linePos;
                 }
 
-                fontGlyphPos_s data;
-                fontCalcGlyphPos(&data, NULL, fontGlyphIndexFromCodePoint(NULL, code), GLYPH_POS_CALC_VTXCOORD, scaleX * font_scale, scaleY * font_scale);
-
-                if(data.sheetIndex >= glyph_count) {
-                    fontCalcGlyphPos(&data, NULL, fontGlyphIndexFromCodePoint(NULL, 0xFFFD), GLYPH_POS_CALC_VTXCOORD, scaleX * font_scale, scaleY * font_scale);
-                }
+                const glyph_info* glyph = glyph_cache_get(code);
 
-                if(data.sheetIndex < glyph_count && data.sheetIndex != lastSheet) {
-                    lastSheet = data.sheetIndex;
-                    C3D_TexBind(0, &glyph_sheets[lastSheet]);
-                }
+                float glyphScaleX = scaleX * font_scale;
+                float glyphScaleY = scaleY * font_scale;
 
                 for(u32 j = 0; j < num; j++) {
-                    screen_draw_quad(currX + data.vtxcoord.left, currY + data.vtxcoord.top, currX + data.vtxcoord.right, currY + data.vtxcoord.bottom, data.texcoord.left, data.texcoord.bottom, data.texcoord.right, data.texcoord.top);
-
-                    currX += data.xAdvance;
+                    if(layout->quadCount >= capacity) {
+                        capacity = capacity > 0 ? capacity * 2 : 32;
+
+                        screen_glyph_quad* quads = (screen_glyph_quad*) realloc(layout->quads, capacity * sizeof(screen_glyph_quad));
+                        if(quads == NULL) {
+                            return false;
+                        }
+
+                        layout->quads = quads;
+                    }
+
+                    screen_glyph_quad* quad = &layout->quads[layout->quadCount++];
+                    quad->sheet = glyph->sheet;
+                    quad->line = i;
+                    quad->x1 = currX + glyphScaleX * glyph->left;
+                    quad->y1 = currY + glyphScaleY * glyph->top;
+                    quad->x2 = currX + glyphScaleX * glyph->right;
+                    quad->y2 = currY + glyphScaleY * glyph->bottom;
+                    quad->left = glyph->texLeft;
+                    quad->bottom = glyph->texBottom;
+                    quad->right = glyph->texRight;
+                    quad->top = glyph->texTop;
+
+                    currX += glyphScaleX * glyph->xAdvance;
                 }
             }
 
@@ -719,7 +1528,132 @@ static void screen_draw_string_internal(const char* text, float x, float y, floa
         lastAlignPos = 0;
     }
 
-    screen_set_blend(0, false, false);
+    layout->text = strdup(text);
+    return layout->text != NULL;
+}
+
+static screen_text_layout* screen_get_text_layout(const char* text, float scaleX, float scaleY, bool wrap, float wrapWidth) {
+    if(!wrap) {
+        wrapWidth = 0;
+    }
+
+    u32 hash = 2166136261U;
+    for(const char* c = text; *c != '\0'; c++) {
+        hash ^= (u8) *c;
+        hash *= 16777619U;
+    }
+
+    text_layout_tick++;
+
+    screen_text_layout* oldest = &text_layouts[0];
+    for(u32 i = 0; i < MAX_TEXT_LAYOUTS; i++) {
+        screen_text_layout* layout = &text_layouts[i];
+
+        if(layout->text != NULL && layout->hash == hash && layout->scaleX == scaleX && layout->scaleY == scaleY
+           && layout->wrap == wrap && layout->wrapWidth == wrapWidth && strcmp(layout->text, text) == 0) {
+            layout->lastUsed = text_layout_tick;
+
+            text_layout_hits++;
+            return layout;
+        }
+
+        if(layout->text == NULL ? oldest->text != NULL : (oldest->text != NULL && layout->lastUsed < oldest->lastUsed)) {
+            oldest = layout;
+        }
+    }
+
+    text_layout_misses++;
+
+    screen_free_text_layout(oldest);
+
+    if(!screen_build_text_layout(oldest, text, scaleX, scaleY, wrap, wrapWidth)) {
+        screen_free_text_layout(oldest);
+        return NULL;
+    }
+
+    oldest->hash = hash;
+    oldest->scaleX = scaleX;
+    oldest->scaleY = scaleY;
+    oldest->wrap = wrap;
+    oldest->wrapWidth = wrapWidth;
+    oldest->lastUsed = text_layout_tick;
+
+    return oldest;
+}
+
+void screen_get_text_cache_stats(u32* hits, u32* misses) {
+    if(hits != NULL) {
+        *hits = text_layout_hits;
+    }
+
+    if(misses != NULL) {
+        *misses = text_layout_misses;
+    }
+}
+
+static void screen_get_string_size_internal(float* width, float* height, const char* text, float scaleX, float scaleY, bool wrap, float wrapWidth) {
+    screen_text_layout* layout = text != NULL ? screen_get_text_layout(text, scaleX, scaleY, wrap, wrapWidth) : NULL;
+    if(layout != NULL) {
+        if(width != NULL) {
+            *width = layout->totalWidth;
+        }
+
+        if(height != NULL) {
+            *height = layout->totalHeight;
+        }
+    } else if(text != NULL) {
+        screen_wrap_string(NULL, NULL, NULL, NULL, width, height, text, 0, wrapWidth, scaleX, scaleY, wrap);
+    }
+}
+
+void screen_get_string_size(float* width, float* height, const char* text, float scaleX, float scaleY) {
+    screen_get_string_size_internal(width, height, text, scaleX, scaleY, false, 0);
+}
+
+void screen_get_string_size_wrap(float* width, float* height, const char* text, float scaleX, float scaleY, float wrapWidth) {
+    screen_get_string_size_internal(width, height, text, scaleX, scaleY, true, wrapWidth);
+}
+
+static void screen_draw_string_internal(const char* text, float x, float y, float scaleX, float scaleY, u32 colorId, bool centerLines, bool wrap, float wrapX) {
+    if(text == NULL) {
+        return;
+    }
+
+    if(colorId >= MAX_COLORS) {
+        error_panic("Attempted to draw string with invalid color ID \"%lu\".", colorId);
+        return;
+    }
+
+    screen_text_layout* layout = screen_get_text_layout(text, scaleX, scaleY, wrap, wrapX - x);
+    if(layout == NULL) {
+        return;
+    }
+
+    u32 blendColor = color_config[colorId];
+    if(base_alpha != 0xFF) {
+        float alpha1 = ((blendColor >> 24) & 0xFF) / 255.0f;
+        float alpha2 = base_alpha / 255.0f;
+        float blendedAlpha = alpha1 * alpha2;
+
+        blendColor = (((u32) (blendedAlpha * 0xFF)) << 24) | (blendColor & 0x00FFFFFF);
+    }
+
+    screen_set_blend(blendColor, true, true);
+
+    for(u32 i = 0; i < layout->quadCount; i++) {
+        screen_glyph_quad* quad = &layout->quads[i];
+
+        if(quad->sheet < glyph_count) {
+            screen_bind_texture(&glyph_sheets[quad->sheet]);
+        }
+
+        float offsetX = x;
+        if(centerLines) {
+            offsetX += (layout->totalWidth - layout->lineWidths[quad->line]) / 2;
+        }
+
+        screen_draw_quad(offsetX + quad->x1, y + quad->y1, offsetX + quad->x2, y + quad->y2, quad->left, quad->bottom, quad->right, quad->top);
+    }
 }
 
 void screen_draw_string(const char* text, float x, float y, float scaleX, float scaleY, u32 colorId, bool centerLines) {
@@ -9,6 +9,8 @@ typedef struct __sFILE FILE;
 #define BOTTOM_SCREEN_HEIGHT 240
 
 #define MAX_TEXTURES 1024
+#define TEXTURE_PLACEHOLDER (MAX_TEXTURES - 1)
+#define TEXTURE_BUDGET_DEFAULT (12 * 1024 * 1024)
 #define MAX_COLORS 32
 
 #define COLOR_TEXT 0
@@ -22,15 +24,22 @@ void screen_load_texture_untiled(u32 id, void* data, u32 size, u32 width, u32 he
 void screen_load_texture_path(u32 id, const char* path, bool linearFilter);
 void screen_load_texture_file(u32 id, FILE* fd, bool linearFilter);
 void screen_load_texture_tiled(u32 id, void* data, u32 size, u32 width, u32 height, GPU_TEXCOLOR format, bool linearFilter);
+void screen_load_texture_atlas(u32 id, void* data, u32 size, u32 width, u32 height, GPU_TEXCOLOR format);
 void screen_unload_texture(u32 id);
+bool screen_get_texture_tiled(u32 id, void* data, u32 size);
 void screen_get_texture_size(u32* width, u32* height, u32 id);
+void screen_set_texture_budget(u32 budget);
+void screen_get_texture_stats(u32* memory, u32* budget, u32* evictions);
+void screen_get_atlas_stats(u32* pages, u32* usedCells, u32* totalCells, u32* bindsSaved);
 void screen_begin_frame();
 void screen_end_frame();
+void screen_get_frame_stats(u32* drawCalls, u32* vertexCount);
 void screen_select(gfxScreen_t screen);
 void screen_draw_texture(u32 id, float x, float y, float width, float height);
 void screen_draw_texture_crop(u32 id, float x, float y, float width, float height);
 float screen_get_font_height(float scaleY);
 void screen_get_string_size(float* width, float* height, const char* text, float scaleX, float scaleY);
 void screen_get_string_size_wrap(float* width, float* height, const char* text, float scaleX, float scaleY, float wrapWidth);
+void screen_get_text_cache_stats(u32* hits, u32* misses);
 void screen_draw_string(const char* text, float x, float y, float scaleX, float scaleY, u32 colorId, bool centerLines);
 void screen_draw_string_wrap(const char* text, float x, float y, float scaleX, float scaleY, u32 colorId, bool centerLines, float wrapX);
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string.h>
+
+#include <3ds.h>
+
+// Morton offsets of a pixel within an 8x8 tile, split into x and y contributions.
+static const u8 tile_x_offsets[8] = {0, 1, 4, 5, 16, 17, 20, 21};
+static const u8 tile_y_offsets[8] = {0, 2, 8, 10, 32, 34, 40, 42};
+
+// Swizzles one source row at a time, so reads stay sequential and each tile row is eight
+// stores at fixed offsets. Each pixel passes through convert on its way.
+#define SCREEN_PIXEL_COPY(px) (px)
+#define SCREEN_PIXEL_RGBA_TO_ABGR(px) __builtin_bswap32(px)
+
+#define SCREEN_SWIZZLE_ROWS(type, dst, src, width, height, pow2Width, convert) \
+    for(u32 y = 0; y < (height); y++) { \
+        const type* srcRow = &(src)[y * (width)]; \
+        type* dstRow = &(dst)[(y >> 3) * ((pow2Width) << 3) + tile_y_offsets[y & 7]]; \
+        \
+        u32 x = 0; \
+        for(; x + 8 <= (width); x += 8) { \
+            type* tile = &dstRow[x << 3]; \
+            tile[0] = convert(srcRow[x + 0]); \
+            tile[1] = convert(srcRow[x + 1]); \
+            tile[4] = convert(srcRow[x + 2]); \
+            tile[5] = convert(srcRow[x + 3]); \
+            tile[16] = convert(srcRow[x + 4]); \
+            tile[17] = convert(srcRow[x + 5]); \
+            tile[20] = convert(srcRow[x + 6]); \
+            tile[21] = convert(srcRow[x + 7]); \
+        } \
+        \
+        for(; x < (width); x++) { \
+            dstRow[((x >> 3) << 6) + tile_x_offsets[x & 7]] = convert(srcRow[x]); \
+        } \
+    }
+
+static inline void screen_swizzle_16(u16* dst, const u16* src, u32 width, u32 height, u32 pow2Width) {
+    SCREEN_SWIZZLE_ROWS(u16, dst, src, width, height, pow2Width, SCREEN_PIXEL_COPY);
+}
+
+static inline void screen_swizzle_32(u32* dst, const u32* src, u32 width, u32 height, u32 pow2Width) {
+    SCREEN_SWIZZLE_ROWS(u32, dst, src, width, height, pow2Width, SCREEN_PIXEL_COPY);
+}
+
+// Reverses each pixel's byte order from RGBA to the GPU's ABGR while tiling, in a single pass.
+static inline void screen_swizzle_rgba_to_abgr(u32* dst, const u32* src, u32 width, u32 height, u32 pow2Width) {
+    SCREEN_SWIZZLE_ROWS(u32, dst, src, width, height, pow2Width, SCREEN_PIXEL_RGBA_TO_ABGR);
+}
+
+static inline void screen_swizzle_generic(u8* dst, const u8* src, u32 width, u32 height, u32 pow2Width, u32 pixelSize) {
+    for(u32 y = 0; y < height; y++) {
+        const u8* srcRow = &src[y * width * pixelSize];
+        u32 dstRow = (y >> 3) * (pow2Width << 3) + tile_y_offsets[y & 7];
+
+        for(u32 x = 0; x < width; x++) {
+            memcpy(&dst[(dstRow + ((x >> 3) << 6) + tile_x_offsets[x & 7]) * pixelSize], &srcRow[x * pixelSize], pixelSize);
+        }
+    }
+}
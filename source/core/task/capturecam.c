@@ -63,6 +63,10 @@ static void task_capture_cam_thread(void* arg) {
                                     GSPGPU_FlushDataCache(data->buffer, bufferSize);
                                     svcReleaseMutex(data->mutex);
 
+                                    if(data->frameEvent != 0) {
+                                        svcSignalEvent(data->frameEvent);
+                                    }
+
                                     res = CAMU_SetReceiving(&events[EVENT_RECV], buffer, PORT_CAM1, bufferSize, (s16) transferUnit);
                                     break;
                                 case EVENT_BUFFER_ERROR:
@@ -11,6 +11,9 @@ typedef struct capture_cam_data_s {
     s16 height;
     capture_cam_camera camera;
 
+    // Signaled after each new frame is copied into buffer, if set.
+    Handle frameEvent;
+
     Handle mutex;
 
     volatile bool finished;
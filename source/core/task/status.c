@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <3ds.h>
+
+#include "status.h"
+#include "task.h"
+#include "../error.h"
+#include "../ui/ui.h"
+
+#define STATUS_SAMPLE_INTERVAL 250
+#define STATUS_FREE_SPACE_INTERVAL 2000
+
+// Battery, wifi, clock and free space are sampled on a low priority thread, so the IPC and
+// FS calls behind them never stall a frame. The info is double buffered: the sampler fills
+// the slot readers are not using and then bumps the sequence to publish it, so a reader
+// never waits on a write in progress. A reader only retries if a whole publish completed
+// while it was copying.
+static status_info status[2];
+static volatile u32 status_sequence;
+
+static Handle status_quit_event;
+static Thread status_thread;
+
+static void task_status_publish(status_info* info) {
+    u32 sequence = __atomic_load_n(&status_sequence, __ATOMIC_RELAXED) + 1;
+
+    memcpy(&status[sequence & 1], info, sizeof(status_info));
+    __atomic_store_n(&status_sequence, sequence, __ATOMIC_RELEASE);
+}
+
+void task_get_status(status_info* info) {
+    u32 sequence = 0;
+
+    do {
+        sequence = __atomic_load_n(&status_sequence, __ATOMIC_ACQUIRE);
+
+        memcpy(info, &status[sequence & 1], sizeof(status_info));
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while(__atomic_load_n(&status_sequence, __ATOMIC_RELAXED) != sequence);
+}
+
+static void task_status_append_free_space(char* buffer, size_t size, FS_SystemMediaType mediaType, const char* name) {
+    FS_ArchiveResource resource = {0};
+    if(R_FAILED(FSUSER_GetArchiveResource(&resource, mediaType))) {
+        return;
+    }
+
+    size_t len = strlen(buffer);
+    if(len >= size) {
+        return;
+    }
+
+    u64 freeSpace = (u64) resource.freeClusters * (u64) resource.clusterSize;
+    snprintf(buffer + len, size - len, "%s%s: %.1f %s", len > 0 ? ", " : "", name, ui_get_display_size(freeSpace), ui_get_display_size_units(freeSpace));
+}
+
+static void task_status_sample(status_info* info, bool freeSpace) {
+    u8 batteryChargeState = 0;
+    info->batteryCharging = R_SUCCEEDED(PTMU_GetBatteryChargeState(&batteryChargeState)) && batteryChargeState;
+
+    u8 batteryLevel = 0;
+    info->batteryLevel = !info->batteryCharging && R_SUCCEEDED(PTMU_GetBatteryLevel(&batteryLevel)) ? batteryLevel : 0;
+
+    u32 wifiStatus = 0;
+    info->wifiConnected = R_SUCCEEDED(ACU_GetWifiStatus(&wifiStatus)) && wifiStatus;
+    info->wifiStrength = info->wifiConnected ? osGetWifiStrength() : 0;
+
+    time_t t = time(NULL);
+    char* timeText = ctime(&t);
+    timeText[strlen(timeText) - 1] = '\0';
+
+    strncpy(info->timeText, timeText, sizeof(info->timeText) - 1);
+    info->timeText[sizeof(info->timeText) - 1] = '\0';
+
+    if(freeSpace) {
+        info->freeSpaceText[0] = '\0';
+
+        task_status_append_free_space(info->freeSpaceText, sizeof(info->freeSpaceText), SYSTEM_MEDIATYPE_SD, "SD");
+        task_status_append_free_space(info->freeSpaceText, sizeof(info->freeSpaceText), SYSTEM_MEDIATYPE_CTR_NAND, "CTR NAND");
+        task_status_append_free_space(info->freeSpaceText, sizeof(info->freeSpaceText), SYSTEM_MEDIATYPE_TWL_NAND, "TWL NAND");
+        task_status_append_free_space(info->freeSpaceText, sizeof(info->freeSpaceText), SYSTEM_MEDIATYPE_TWL_PHOTO, "TWL Photo");
+    }
+}
+
+static void task_status_thread(void* arg) {
+    status_info info;
+    task_get_status(&info);
+
+    u64 lastFreeSpaceTime = osGetTime();
+
+    while(svcWaitSynchronization(status_quit_event, STATUS_SAMPLE_INTERVAL * 1000000LL) != 0) {
+        svcWaitSynchronization(task_get_pause_event(), U64_MAX);
+
+        u64 time = osGetTime();
+        bool freeSpace = time - lastFreeSpaceTime >= STATUS_FREE_SPACE_INTERVAL;
+        if(freeSpace) {
+            lastFreeSpaceTime = time;
+        }
+
+        status_info last = info;
+        task_status_sample(&info, freeSpace);
+
+        if(memcmp(&info, &last, sizeof(status_info)) != 0) {
+            task_status_publish(&info);
+            ui_invalidate();
+        }
+    }
+}
+
+void task_status_init() {
+    Result res = 0;
+    if(R_FAILED(res = svcCreateEvent(&status_quit_event, RESET_STICKY))) {
+        error_panic("Failed to create status quit event: 0x%08lX", res);
+        return;
+    }
+
+    // Sample once up front so the first frame has real values to show.
+    status_info info;
+    memset(&info, 0, sizeof(info));
+    task_status_sample(&info, true);
+    task_status_publish(&info);
+
+    if((status_thread = threadCreate(task_status_thread, NULL, 0x10000, 0x3F, 0, false)) == NULL) {
+        svcCloseHandle(status_quit_event);
+        status_quit_event = 0;
+
+        error_panic("Failed to create status thread.");
+        return;
+    }
+}
+
+void task_status_exit() {
+    if(status_thread != NULL) {
+        svcSignalEvent(status_quit_event);
+
+        threadJoin(status_thread, U64_MAX);
+        threadFree(status_thread);
+        status_thread = NULL;
+    }
+
+    if(status_quit_event != 0) {
+        svcCloseHandle(status_quit_event);
+        status_quit_event = 0;
+    }
+}
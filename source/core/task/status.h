@@ -0,0 +1,19 @@
+#pragma once
+
+#define STATUS_TIME_TEXT_MAX 32
+#define STATUS_FREE_SPACE_TEXT_MAX 128
+
+typedef struct status_info_s {
+    bool batteryCharging;
+    u8 batteryLevel;
+
+    bool wifiConnected;
+    u8 wifiStrength;
+
+    char timeText[STATUS_TIME_TEXT_MAX];
+    char freeSpaceText[STATUS_FREE_SPACE_TEXT_MAX];
+} status_info;
+
+void task_status_init();
+void task_status_exit();
+void task_get_status(status_info* info);
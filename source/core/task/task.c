@@ -48,11 +48,15 @@ void task_init() {
     svcSignalEvent(task_suspend_event);
 
     aptHook(&cookie, task_apt_hook, NULL);
+
+    task_status_init();
 }
 
 void task_exit() {
     task_quit = true;
 
+    task_status_exit();
+
     aptUnhook(&cookie);
 
     if(task_pause_event != 0) {
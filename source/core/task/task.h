@@ -7,4 +7,5 @@ Handle task_get_pause_event();
 Handle task_get_suspend_event();
 
 #include "capturecam.h"
-#include "dataop.h"
\ No newline at end of file
+#include "dataop.h"
+#include "status.h"
\ No newline at end of file
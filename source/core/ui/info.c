@@ -1,5 +1,6 @@
 #include <malloc.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <3ds.h>
 
@@ -22,7 +23,16 @@ static void info_update(ui_view* view, void* data, float bx1, float by1, float b
     info_data* infoData = (info_data*) data;
 
     if(infoData->update != NULL) {
+        float lastProgress = infoData->progress;
+
+        char lastText[PROGRESS_TEXT_MAX];
+        strncpy(lastText, infoData->text, sizeof(lastText));
+
         infoData->update(view, infoData->data, &infoData->progress, infoData->text);
+
+        if(infoData->progress != lastProgress || strncmp(infoData->text, lastText, sizeof(lastText)) != 0) {
+            ui_invalidate();
+        }
     }
 }
 
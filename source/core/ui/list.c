@@ -5,13 +5,13 @@
 #include "error_display.h"
 #include "list.h"
 #include "ui.h"
+#include "../arraylist.h"
 #include "../screen.h"
-#include "../linkedlist.h"
 #include "../../fbi/resources.h"
 
 typedef struct {
     void* data;
-    linked_list items;
+    array_list items;
     u32 selectedIndex;
     list_item* selectedItem;
     u32 selectionScroll;
@@ -19,12 +19,13 @@ typedef struct {
     float scrollPos;
     u32 lastScrollTouchY;
     u64 nextActionTime;
-    void (*update)(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched);
+    u32 lastSize;
+    void (*update)(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched);
     void (*drawTop)(ui_view* view, void* data, float x1, float y1, float x2, float y2, list_item* selected);
 } list_data;
 
 static void list_validate(list_data* listData, float by1, float by2) {
-    u32 size = linked_list_size(&listData->items);
+    u32 size = array_list_size(&listData->items);
 
     if(size == 0 || listData->selectedIndex < 0) {
         listData->selectedIndex = 0;
@@ -46,7 +47,11 @@ static void list_validate(list_data* listData, float by1, float by2) {
         if(listData->selectedItem != NULL) {
             u32 oldIndex = listData->selectedIndex;
 
-            int index = linked_list_index_of(&listData->items, listData->selectedItem);
+            int index = (int) listData->selectedIndex;
+            if(array_list_get(&listData->items, listData->selectedIndex) != listData->selectedItem) {
+                index = array_list_index_of(&listData->items, listData->selectedItem);
+            }
+
             if(index != -1) {
                 found = true;
                 listData->selectedIndex = (u32) index;
@@ -58,7 +63,7 @@ static void list_validate(list_data* listData, float by1, float by2) {
         }
 
         if(!found) {
-            listData->selectedItem = linked_list_get(&listData->items, listData->selectedIndex);
+            listData->selectedItem = array_list_get(&listData->items, listData->selectedIndex);
 
             listData->selectionScroll = 0;
             listData->nextSelectionScrollResetTime = 0;
@@ -89,7 +94,13 @@ static void list_validate(list_data* listData, float by1, float by2) {
 static void list_update(ui_view* view, void* data, float bx1, float by1, float bx2, float by2) {
     list_data* listData = (list_data*) data;
 
-    u32 size = linked_list_size(&listData->items);
+    u32 size = array_list_size(&listData->items);
+
+    u32 lastSize = listData->lastSize;
+    u32 lastIndex = listData->selectedIndex;
+    list_item* lastItem = listData->selectedItem;
+    u32 lastSelectionScroll = listData->selectionScroll;
+    float lastScrollPos = listData->scrollPos;
 
     list_validate(listData, by1, by2);
 
@@ -185,7 +196,7 @@ static void list_update(ui_view* view, void* data, float bx1, float by1, float b
         }
 
         if(listData->selectedIndex != lastSelectedIndex) {
-            listData->selectedItem = linked_list_get(&listData->items, listData->selectedIndex);
+            listData->selectedItem = array_list_get(&listData->items, listData->selectedIndex);
 
             listData->selectionScroll = 0;
             listData->nextSelectionScrollResetTime = 0;
@@ -197,6 +208,13 @@ static void list_update(ui_view* view, void* data, float bx1, float by1, float b
     if(listData->update != NULL) {
         listData->update(view, listData->data, &listData->items, listData->selectedItem, selectedTouched);
     }
+
+    listData->lastSize = array_list_size(&listData->items);
+
+    if(listData->lastSize != lastSize || listData->selectedIndex != lastIndex || listData->selectedItem != lastItem
+       || listData->selectionScroll != lastSelectionScroll || listData->scrollPos != lastScrollPos) {
+        ui_invalidate();
+    }
 }
 
 static void list_draw_top(ui_view* view, void* data, float x1, float y1, float x2, float y2) {
@@ -217,15 +235,15 @@ static void list_draw_bottom(ui_view* view, void* data, float x1, float y1, floa
     float fontHeight = screen_get_font_height(0.5f);
     float y = y1 - listData->scrollPos;
 
-    linked_list_iter iter;
-    linked_list_iterate(&listData->items, &iter);
+    array_list_iter iter;
+    array_list_iterate(&listData->items, &iter);
 
-    while(linked_list_iter_has_next(&iter)) {
+    while(array_list_iter_has_next(&iter)) {
         if(y > y2) {
             break;
         }
 
-        list_item* item = linked_list_iter_next(&iter);
+        list_item* item = array_list_iter_next(&iter);
 
         if(y > y1 - fontHeight) {
             float x = x1 + 2;
@@ -245,7 +263,7 @@ static void list_draw_bottom(ui_view* view, void* data, float x1, float y1, floa
         y += fontHeight;
     }
 
-    u32 size = linked_list_size(&listData->items);
+    u32 size = array_list_size(&listData->items);
     if(size > 0) {
         float totalHeight = size * fontHeight;
         float viewHeight = y2 - y1;
@@ -264,7 +282,7 @@ static void list_draw_bottom(ui_view* view, void* data, float x1, float y1, floa
     }
 }
 
-ui_view* list_display(const char* name, const char* info, void* data, void (*update)(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched),
+ui_view* list_display(const char* name, const char* info, void* data, void (*update)(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched),
                                                                       void (*drawTop)(ui_view* view, void* data, float x1, float y1, float x2, float y2, list_item* selected)) {
     list_data* listData = (list_data*) calloc(1, sizeof(list_data));
     if(listData == NULL) {
@@ -274,7 +292,7 @@ ui_view* list_display(const char* name, const char* info, void* data, void (*upd
     }
 
     listData->data = data;
-    linked_list_init(&listData->items);
+    array_list_init(&listData->items);
     listData->selectedIndex = 0;
     listData->selectedItem = NULL;
     listData->selectionScroll = 0;
@@ -298,7 +316,7 @@ ui_view* list_display(const char* name, const char* info, void* data, void (*upd
 
 void list_destroy(ui_view* view) {
     if(view != NULL) {
-        linked_list_destroy(&((list_data*) view->data)->items);
+        array_list_destroy(&((list_data*) view->data)->items);
 
         free(view->data);
         ui_destroy(view);
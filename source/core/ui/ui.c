@@ -1,6 +1,5 @@
 #include <stdio.h>
 #include <string.h>
-#include <time.h>
 
 #include <3ds.h>
 #include <malloc.h>
@@ -9,21 +8,30 @@
 #include "../error.h"
 #include "../screen.h"
 #include "../data/smdh.h"
+#include "../task/task.h"
 #include "../../fbi/resources.h"
 
 #define MAX_UI_VIEWS 16
 
+// Frames are only drawn when something on screen may have changed. Changes that are not
+// reported through ui_invalidate, such as list items updated in place, are still picked up
+// at this interval.
+#define UI_IDLE_FRAME_INTERVAL 250
+
 static ui_view* ui_stack[MAX_UI_VIEWS];
 static int ui_stack_top = -1;
 
 static Handle ui_stack_mutex = 0;
 
-static u64 ui_free_space_last_update = 0;
-static char ui_free_space_buffer[128];
-
 static u64 ui_fade_begin_time = 0;
 static u8 ui_fade_alpha = 0;
 
+static volatile bool ui_dirty = true;
+static ui_view* ui_last_drawn_view = NULL;
+static u64 ui_last_frame_time = 0;
+static u32 ui_frames_rendered = 0;
+static u32 ui_frames_skipped = 0;
+
 void ui_init() {
     if(ui_stack_mutex == 0) {
         svcCreateMutex(&ui_stack_mutex, false);
@@ -89,6 +97,8 @@ bool ui_push(ui_view* view) {
         ui_stack[++ui_stack_top] = view;
 
         svcClearEvent(view->active);
+
+        ui_dirty = true;
     }
 
     svcReleaseMutex(ui_stack_mutex);
@@ -103,11 +113,56 @@ void ui_pop() {
         svcSignalEvent(ui_stack[ui_stack_top]->active);
 
         ui_stack[ui_stack_top--] = NULL;
+
+        ui_dirty = true;
     }
 
     svcReleaseMutex(ui_stack_mutex);
 }
 
+#ifdef DEBUG_STATS
+// Drawn as one string, so the overlay costs the text layout cache a single miss per frame.
+static void ui_draw_debug_stats(float x, float y) {
+    u32 rendered = 0;
+    u32 skipped = 0;
+    ui_get_frame_stats(&rendered, &skipped);
+
+    u32 drawCalls = 0;
+    u32 vertexCount = 0;
+    screen_get_frame_stats(&drawCalls, &vertexCount);
+
+    u32 textHits = 0;
+    u32 textMisses = 0;
+    screen_get_text_cache_stats(&textHits, &textMisses);
+
+    u32 textureMemory = 0;
+    u32 textureBudget = 0;
+    u32 textureEvictions = 0;
+    screen_get_texture_stats(&textureMemory, &textureBudget, &textureEvictions);
+
+    u32 atlasPages = 0;
+    u32 atlasUsedCells = 0;
+    u32 atlasTotalCells = 0;
+    u32 atlasBindsSaved = 0;
+    screen_get_atlas_stats(&atlasPages, &atlasUsedCells, &atlasTotalCells, &atlasBindsSaved);
+
+    char statsText[512];
+    snprintf(statsText, sizeof(statsText),
+             "Frames: %lu drawn, %lu skipped\n"
+             "Last frame: %lu draw calls, %lu vertices\n"
+             "Text layouts: %lu hits, %lu misses\n"
+             "Textures: %lu / %lu KiB, %lu evicted\n"
+             "Atlas: %lu pages, %lu / %lu cells, %lu binds saved",
+             rendered, skipped,
+             drawCalls, vertexCount,
+             textHits, textMisses,
+             textureMemory / 1024, textureBudget / 1024, textureEvictions,
+             atlasPages, atlasUsedCells, atlasTotalCells, atlasBindsSaved);
+
+    screen_draw_string(statsText, x, y, 0.35f, 0.35f, COLOR_TEXT, false);
+}
+#endif
+
 static void ui_draw_top(ui_view* ui) {
     screen_select(GFX_TOP);
 
@@ -157,25 +212,17 @@ static void ui_draw_top(ui_view* ui) {
     screen_get_string_size(&verWidth, &verHeight, verText, 0.5f, 0.5f);
     screen_draw_string(verText, topScreenTopBarX + 2, topScreenTopBarY + (topScreenTopBarHeight - verHeight) / 2, 0.5f, 0.5f, COLOR_TEXT, true);
 
-    time_t t = time(NULL);
-    char* timeText = ctime(&t);
-    timeText[strlen(timeText) - 1] = '\0';
+    status_info status;
+    task_get_status(&status);
+
+    const char* timeText = status.timeText;
 
     float timeTextWidth;
     float timeTextHeight;
     screen_get_string_size(&timeTextWidth, &timeTextHeight, timeText, 0.5f, 0.5f);
     screen_draw_string(timeText, topScreenTopBarX + (topScreenTopBarWidth - timeTextWidth) / 2, topScreenTopBarY + (topScreenTopBarHeight - timeTextHeight) / 2, 0.5f, 0.5f, COLOR_TEXT, true);
 
-    u32 batteryIcon = 0;
-    u8 batteryChargeState = 0;
-    u8 batteryLevel = 0;
-    if(R_SUCCEEDED(PTMU_GetBatteryChargeState(&batteryChargeState)) && batteryChargeState) {
-        batteryIcon = TEXTURE_BATTERY_CHARGING;
-    } else if(R_SUCCEEDED(PTMU_GetBatteryLevel(&batteryLevel))) {
-        batteryIcon = TEXTURE_BATTERY_0 + batteryLevel;
-    } else {
-        batteryIcon = TEXTURE_BATTERY_0;
-    }
+    u32 batteryIcon = status.batteryCharging ? TEXTURE_BATTERY_CHARGING : TEXTURE_BATTERY_0 + status.batteryLevel;
 
     u32 batteryWidth;
     u32 batteryHeight;
@@ -185,13 +232,7 @@ static void ui_draw_top(ui_view* ui) {
     float batteryY = topScreenTopBarY + (topScreenTopBarHeight - batteryHeight) / 2;
     screen_draw_texture(batteryIcon, batteryX, batteryY, batteryWidth, batteryHeight);
 
-    u32 wifiIcon = 0;
-    u32 wifiStatus = 0;
-    if(R_SUCCEEDED(ACU_GetWifiStatus(&wifiStatus)) && wifiStatus) {
-        wifiIcon = TEXTURE_WIFI_0 + osGetWifiStrength();
-    } else {
-        wifiIcon = TEXTURE_WIFI_DISCONNECTED;
-    }
+    u32 wifiIcon = status.wifiConnected ? TEXTURE_WIFI_0 + status.wifiStrength : TEXTURE_WIFI_DISCONNECTED;
 
     u32 wifiWidth;
     u32 wifiHeight;
@@ -201,65 +242,14 @@ static void ui_draw_top(ui_view* ui) {
     float wifiY = topScreenTopBarY + (topScreenTopBarHeight - wifiHeight) / 2;
     screen_draw_texture(wifiIcon, wifiX, wifiY, wifiWidth, wifiHeight);
 
-    if(osGetTime() >= ui_free_space_last_update + 1000) {
-        char* currBuffer = ui_free_space_buffer;
-        FS_ArchiveResource resource = {0};
-
-        if(R_SUCCEEDED(FSUSER_GetArchiveResource(&resource, SYSTEM_MEDIATYPE_SD)) && currBuffer < ui_free_space_buffer + sizeof(ui_free_space_buffer)) {
-            if(currBuffer != ui_free_space_buffer) {
-                snprintf(currBuffer, sizeof(ui_free_space_buffer) - (currBuffer - ui_free_space_buffer), ", ");
-                currBuffer += strlen(currBuffer);
-            }
-
-            u64 size = (u64) resource.freeClusters * (u64) resource.clusterSize;
-            snprintf(currBuffer, sizeof(ui_free_space_buffer) - (currBuffer - ui_free_space_buffer), "SD: %.1f %s",
-                     ui_get_display_size(size), ui_get_display_size_units(size));
-            currBuffer += strlen(currBuffer);
-        }
-
-        if(R_SUCCEEDED(FSUSER_GetArchiveResource(&resource, SYSTEM_MEDIATYPE_CTR_NAND)) && currBuffer < ui_free_space_buffer + sizeof(ui_free_space_buffer)) {
-            if(currBuffer != ui_free_space_buffer) {
-                snprintf(currBuffer, sizeof(ui_free_space_buffer) - (currBuffer - ui_free_space_buffer), ", ");
-                currBuffer += strlen(currBuffer);
-            }
-
-            u64 size = (u64) resource.freeClusters * (u64) resource.clusterSize;
-            snprintf(currBuffer, sizeof(ui_free_space_buffer) - (currBuffer - ui_free_space_buffer), "CTR NAND: %.1f %s",
-                     ui_get_display_size(size), ui_get_display_size_units(size));
-            currBuffer += strlen(currBuffer);
-        }
-
-        if(R_SUCCEEDED(FSUSER_GetArchiveResource(&resource, SYSTEM_MEDIATYPE_TWL_NAND)) && currBuffer < ui_free_space_buffer + sizeof(ui_free_space_buffer)) {
-            if(currBuffer != ui_free_space_buffer) {
-                snprintf(currBuffer, sizeof(ui_free_space_buffer) - (currBuffer - ui_free_space_buffer), ", ");
-                currBuffer += strlen(currBuffer);
-            }
-
-            u64 size = (u64) resource.freeClusters * (u64) resource.clusterSize;
-            snprintf(currBuffer, sizeof(ui_free_space_buffer) - (currBuffer - ui_free_space_buffer), "TWL NAND: %.1f %s",
-                     ui_get_display_size(size), ui_get_display_size_units(size));
-            currBuffer += strlen(currBuffer);
-        }
-
-        if(R_SUCCEEDED(FSUSER_GetArchiveResource(&resource, SYSTEM_MEDIATYPE_TWL_PHOTO)) && currBuffer < ui_free_space_buffer + sizeof(ui_free_space_buffer)) {
-            if(currBuffer != ui_free_space_buffer) {
-                snprintf(currBuffer, sizeof(ui_free_space_buffer) - (currBuffer - ui_free_space_buffer), ", ");
-                currBuffer += strlen(currBuffer);
-            }
-
-            u64 size = (u64) resource.freeClusters * (u64) resource.clusterSize;
-            snprintf(currBuffer, sizeof(ui_free_space_buffer) - (currBuffer - ui_free_space_buffer), "TWL Photo: %.1f %s",
-                     ui_get_display_size(size), ui_get_display_size_units(size));
-            currBuffer += strlen(currBuffer);
-        }
-
-        ui_free_space_last_update = osGetTime();
-    }
-
     float freeSpaceHeight;
-    screen_get_string_size(NULL, &freeSpaceHeight, ui_free_space_buffer, 0.35f, 0.35f);
+    screen_get_string_size(NULL, &freeSpaceHeight, status.freeSpaceText, 0.35f, 0.35f);
 
-    screen_draw_string(ui_free_space_buffer, topScreenBottomBarX + 2, topScreenBottomBarY + (topScreenBottomBarHeight - freeSpaceHeight) / 2, 0.35f, 0.35f, COLOR_TEXT, true);
+    screen_draw_string(status.freeSpaceText, topScreenBottomBarX + 2, topScreenBottomBarY + (topScreenBottomBarHeight - freeSpaceHeight) / 2, 0.35f, 0.35f, COLOR_TEXT, true);
+
+#ifdef DEBUG_STATS
+    ui_draw_debug_stats(topScreenTopBarX + 2, topScreenTopBarY + topScreenTopBarHeight + topScreenTopBarShadowHeight);
+#endif
 
     screen_set_base_alpha(0xFF);
 }
@@ -335,11 +325,29 @@ static void ui_draw_bottom(ui_view* ui) {
     screen_set_base_alpha(0xFF);
 }
 
+void ui_invalidate() {
+    ui_dirty = true;
+}
+
+void ui_get_frame_stats(u32* rendered, u32* skipped) {
+    if(rendered != NULL) {
+        *rendered = ui_frames_rendered;
+    }
+
+    if(skipped != NULL) {
+        *skipped = ui_frames_skipped;
+    }
+}
+
 bool ui_update() {
     ui_view* ui = NULL;
 
     hidScanInput();
 
+    if(hidKeysDown() | hidKeysHeld() | hidKeysUp()) {
+        ui_dirty = true;
+    }
+
     ui = ui_top();
     if(ui != NULL && ui->update != NULL) {
         u32 bottomScreenTopBarHeight = 0;
@@ -354,16 +362,32 @@ bool ui_update() {
     u64 time = osGetTime();
     if(!envIsHomebrew() && time - ui_fade_begin_time < 500) {
         ui_fade_alpha = (u8) (((time - ui_fade_begin_time) / 500.0f) * 0xFF);
-    } else {
+        ui_dirty = true;
+    } else if(ui_fade_alpha != 0xFF) {
         ui_fade_alpha = 0xFF;
+        ui_dirty = true;
     }
 
     ui = ui_top();
     if(ui != NULL) {
-        screen_begin_frame();
-        ui_draw_top(ui);
-        ui_draw_bottom(ui);
-        screen_end_frame();
+        if(ui_dirty || ui != ui_last_drawn_view || time - ui_last_frame_time >= UI_IDLE_FRAME_INTERVAL) {
+            // Cleared before drawing, so changes made while the frame is drawn get their own frame.
+            ui_dirty = false;
+            ui_last_drawn_view = ui;
+            ui_last_frame_time = time;
+
+            screen_begin_frame();
+            ui_draw_top(ui);
+            ui_draw_bottom(ui);
+            screen_end_frame();
+
+            ui_frames_rendered++;
+        } else {
+            // Nothing to draw; wait out the frame so the loop keeps its pace without using the CPU.
+            gspWaitForVBlank();
+
+            ui_frames_skipped++;
+        }
     }
 
     return ui != NULL;
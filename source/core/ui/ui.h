@@ -21,6 +21,8 @@ ui_view* ui_top();
 bool ui_push(ui_view* view);
 void ui_pop();
 bool ui_update();
+void ui_invalidate();
+void ui_get_frame_stats(u32* rendered, u32* skipped);
 
 const char* ui_get_display_eta(u32 seconds);
 double ui_get_display_size(u64 size);
@@ -1,54 +1,54 @@
 #pragma once
 
 typedef struct ticket_info_s ticket_info;
-typedef struct linked_list_s linked_list;
+typedef struct array_list_s array_list;
 typedef struct list_item_s list_item;
 typedef struct ui_view_s ui_view;
 
 #define INSTALL_URLS_MAX 128
 
-void action_browse_boss_ext_save_data(linked_list* items, list_item* selected);
-void action_browse_user_ext_save_data(linked_list* items, list_item* selected);
-void action_delete_ext_save_data(linked_list* items, list_item* selected);
-
-void action_browse_system_save_data(linked_list* items, list_item* selected);
-void action_delete_system_save_data(linked_list* items, list_item* selected);
-
-void action_install_cia(linked_list* items, list_item* selected);
-void action_install_cia_delete(linked_list* items, list_item* selected);
-void action_install_cias(linked_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData);
-void action_install_cias_delete(linked_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData);
-void action_install_ticket(linked_list* items, list_item* selected);
-void action_install_ticket_delete(linked_list* items, list_item* selected);
-void action_install_tickets(linked_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData);
-void action_install_tickets_delete(linked_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData);
-void action_delete_file(linked_list* items, list_item* selected);
-void action_delete_dir(linked_list* items, list_item* selected);
-void action_delete_dir_contents(linked_list* items, list_item* selected);
-void action_delete_dir_cias(linked_list* items, list_item* selected);
-void action_delete_dir_tickets(linked_list* items, list_item* selected);
-void action_new_folder(linked_list* items, list_item* selected);
-void action_paste_contents(linked_list* items, list_item* selected);
-void action_rename(linked_list* items, list_item* selected);
-
-void action_delete_pending_title(linked_list* items, list_item* selected);
-void action_delete_all_pending_titles(linked_list* items, list_item* selected);
-
-void action_delete_ticket(linked_list* items, list_item* selected);
-void action_delete_tickets_unused(linked_list* items, list_item* selected);
-
-void action_delete_title(linked_list* items, list_item* selected);
-void action_delete_title_ticket(linked_list* items, list_item* selected);
-void action_launch_title(linked_list* items, list_item* selected);
-void action_extract_smdh(linked_list* items, list_item* selected);
-void action_import_seed(linked_list* items, list_item* selected);
-void action_erase_twl_save(linked_list* items, list_item* selected);
-void action_export_twl_save(linked_list* items, list_item* selected);
-void action_import_twl_save(linked_list* items, list_item* selected);
-void action_browse_title_save_data(linked_list* items, list_item* selected);
-void action_import_secure_value(linked_list* items, list_item* selected);
-void action_export_secure_value(linked_list* items, list_item* selected);
-void action_delete_secure_value(linked_list* items, list_item* selected);
+void action_browse_boss_ext_save_data(array_list* items, list_item* selected);
+void action_browse_user_ext_save_data(array_list* items, list_item* selected);
+void action_delete_ext_save_data(array_list* items, list_item* selected);
+
+void action_browse_system_save_data(array_list* items, list_item* selected);
+void action_delete_system_save_data(array_list* items, list_item* selected);
+
+void action_install_cia(array_list* items, list_item* selected);
+void action_install_cia_delete(array_list* items, list_item* selected);
+void action_install_cias(array_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData);
+void action_install_cias_delete(array_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData);
+void action_install_ticket(array_list* items, list_item* selected);
+void action_install_ticket_delete(array_list* items, list_item* selected);
+void action_install_tickets(array_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData);
+void action_install_tickets_delete(array_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData);
+void action_delete_file(array_list* items, list_item* selected);
+void action_delete_dir(array_list* items, list_item* selected);
+void action_delete_dir_contents(array_list* items, list_item* selected);
+void action_delete_dir_cias(array_list* items, list_item* selected);
+void action_delete_dir_tickets(array_list* items, list_item* selected);
+void action_new_folder(array_list* items, list_item* selected);
+void action_paste_contents(array_list* items, list_item* selected);
+void action_rename(array_list* items, list_item* selected);
+
+void action_delete_pending_title(array_list* items, list_item* selected);
+void action_delete_all_pending_titles(array_list* items, list_item* selected);
+
+void action_delete_ticket(array_list* items, list_item* selected);
+void action_delete_tickets_unused(array_list* items, list_item* selected);
+
+void action_delete_title(array_list* items, list_item* selected);
+void action_delete_title_ticket(array_list* items, list_item* selected);
+void action_launch_title(array_list* items, list_item* selected);
+void action_extract_smdh(array_list* items, list_item* selected);
+void action_import_seed(array_list* items, list_item* selected);
+void action_erase_twl_save(array_list* items, list_item* selected);
+void action_export_twl_save(array_list* items, list_item* selected);
+void action_import_twl_save(array_list* items, list_item* selected);
+void action_browse_title_save_data(array_list* items, list_item* selected);
+void action_import_secure_value(array_list* items, list_item* selected);
+void action_export_secure_value(array_list* items, list_item* selected);
+void action_delete_secure_value(array_list* items, list_item* selected);
 
 void action_install_url(const char* confirmMessage, const char* urls, const char* paths, void* userData,
                         void (*finishedURL)(void* data, u32 index),
@@ -5,7 +5,7 @@
 #include "../task/uitask.h"
 #include "../../core/core.h"
 
-void action_browse_system_save_data(linked_list* items, list_item* selected) {
+void action_browse_system_save_data(array_list* items, list_item* selected) {
     system_save_data_info* info = (system_save_data_info*) selected->data;
 
     u32 path[2] = {MEDIATYPE_NAND, info->systemSaveDataId};
@@ -10,12 +10,13 @@
 #include "../../core/core.h"
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
+    string_map itemIndex;
 
     list_item* targetItem;
     file_info* target;
 
-    linked_list contents;
+    array_list contents;
 
     data_op_data deleteInfo;
 } delete_data;
@@ -25,7 +26,7 @@ static void action_delete_draw_top(ui_view* view, void* data, float x1, float y1
 
     u32 curr = deleteData->deleteInfo.processed;
     if(curr < deleteData->deleteInfo.total) {
-        task_draw_file_info(view, ((list_item*) linked_list_get(&deleteData->contents, linked_list_size(&deleteData->contents) - curr - 1))->data, x1, y1, x2, y2);
+        task_draw_file_info(view, ((list_item*) array_list_get(&deleteData->contents, array_list_size(&deleteData->contents) - curr - 1))->data, x1, y1, x2, y2);
     } else {
         task_draw_file_info(view, deleteData->target, x1, y1, x2, y2);
     }
@@ -36,7 +37,7 @@ static Result action_delete_delete(void* data, u32 index) {
 
     Result res = 0;
 
-    file_info* info = (file_info*) ((list_item*) linked_list_get(&deleteData->contents, linked_list_size(&deleteData->contents) - index - 1))->data;
+    file_info* info = (file_info*) ((list_item*) array_list_get(&deleteData->contents, array_list_size(&deleteData->contents) - index - 1))->data;
 
     FS_Path* fsPath = fs_make_path_utf8(info->path);
     if(fsPath != NULL) {
@@ -52,18 +53,7 @@ static Result action_delete_delete(void* data, u32 index) {
     }
 
     if(R_SUCCEEDED(res)) {
-        linked_list_iter iter;
-        linked_list_iterate(deleteData->items, &iter);
-
-        while(linked_list_iter_has_next(&iter)) {
-            list_item* item = (list_item*) linked_list_iter_next(&iter);
-            file_info* currInfo = (file_info*) item->data;
-
-            if(strncmp(currInfo->path, info->path, FILE_PATH_MAX) == 0) {
-                linked_list_iter_remove(&iter);
-                task_free_file(item);
-            }
-        }
+        task_remove_file(deleteData->items, &deleteData->itemIndex, info->path);
     }
 
     return res;
@@ -84,7 +74,8 @@ static bool action_delete_error(void* data, u32 index, Result res, ui_view** err
 
 static void action_delete_free_data(delete_data* data) {
     task_clear_files(&data->contents);
-    linked_list_destroy(&data->contents);
+    array_list_destroy(&data->contents);
+    string_map_destroy(&data->itemIndex);
 
     if(data->targetItem != NULL) {
         task_free_file(data->targetItem);
@@ -158,7 +149,7 @@ static void action_delete_loading_update(ui_view* view, void* data, float* progr
         info_destroy(view);
 
         if(R_SUCCEEDED(loadingData->popData.result)) {
-            loadingData->deleteData->deleteInfo.total = linked_list_size(&loadingData->deleteData->contents);
+            loadingData->deleteData->deleteInfo.total = array_list_size(&loadingData->deleteData->contents);
             loadingData->deleteData->deleteInfo.processed = loadingData->deleteData->deleteInfo.total;
 
             prompt_display_yes_no("Confirmation", loadingData->message, COLOR_TEXT, loadingData->deleteData, action_delete_draw_top, action_delete_onresponse);
@@ -179,7 +170,7 @@ static void action_delete_loading_update(ui_view* view, void* data, float* progr
     snprintf(text, PROGRESS_TEXT_MAX, "Fetching content list...");
 }
 
-static void action_delete_internal(linked_list* items, list_item* selected, const char* message, bool recursive, bool includeBase, bool ciasOnly, bool ticketsOnly) {
+static void action_delete_internal(array_list* items, list_item* selected, const char* message, bool recursive, bool includeBase, bool ciasOnly, bool ticketsOnly) {
     delete_data* data = (delete_data*) calloc(1, sizeof(delete_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate delete data.");
@@ -188,6 +179,7 @@ static void action_delete_internal(linked_list* items, list_item* selected, cons
     }
 
     data->items = items;
+    string_map_init(&data->itemIndex);
 
     file_info* targetInfo = (file_info*) selected->data;
     Result targetCreateRes = task_create_file_item(&data->targetItem, targetInfo->archive, targetInfo->path, targetInfo->attributes, false);
@@ -213,7 +205,7 @@ static void action_delete_internal(linked_list* items, list_item* selected, cons
 
     data->deleteInfo.finished = false;
 
-    linked_list_init(&data->contents);
+    array_list_init(&data->contents);
 
     delete_loading_data* loadingData = (delete_loading_data*) calloc(1, sizeof(delete_loading_data));
     if(loadingData == NULL) {
@@ -247,22 +239,22 @@ static void action_delete_internal(linked_list* items, list_item* selected, cons
     info_display("Loading", "Press B to cancel.", false, loadingData, action_delete_loading_update, action_delete_loading_draw_top);
 }
 
-void action_delete_file(linked_list* items, list_item* selected) {
+void action_delete_file(array_list* items, list_item* selected) {
     action_delete_internal(items, selected, "Delete the selected file?", false, true, false, false);
 }
 
-void action_delete_dir(linked_list* items, list_item* selected) {
+void action_delete_dir(array_list* items, list_item* selected) {
     action_delete_internal(items, selected, "Delete the current directory?", true, true, false, false);
 }
 
-void action_delete_dir_contents(linked_list* items, list_item* selected) {
+void action_delete_dir_contents(array_list* items, list_item* selected) {
     action_delete_internal(items, selected, "Delete all contents of the current directory?", true, false, false, false);
 }
 
-void action_delete_dir_cias(linked_list* items, list_item* selected) {
+void action_delete_dir_cias(array_list* items, list_item* selected) {
     action_delete_internal(items, selected, "Delete all CIAs in the current directory?", false, false, true, false);
 }
 
-void action_delete_dir_tickets(linked_list* items, list_item* selected) {
+void action_delete_dir_tickets(array_list* items, list_item* selected) {
     action_delete_internal(items, selected, "Delete all tickets in the current directory?", false, false, false, true);
 }
\ No newline at end of file
@@ -8,7 +8,7 @@
 #include "../../core/core.h"
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
 } delete_ext_save_data_data;
 
@@ -29,7 +29,7 @@ static void action_delete_ext_save_data_update(ui_view* view, void* data, float*
     if(R_FAILED(res)) {
         error_display_res(info, task_draw_ext_save_data_info, res, "Failed to delete ext save data.");
     } else {
-        linked_list_remove(deleteData->items, deleteData->selected);
+        array_list_remove(deleteData->items, deleteData->selected);
         task_free_ext_save_data(deleteData->selected);
 
         prompt_display_notify("Success", "Ext save data deleted.", COLOR_TEXT, NULL, NULL, NULL);
@@ -46,7 +46,7 @@ static void action_delete_ext_save_data_onresponse(ui_view* view, void* data, u3
     }
 }
 
-void action_delete_ext_save_data(linked_list* items, list_item* selected) {
+void action_delete_ext_save_data(array_list* items, list_item* selected) {
     delete_ext_save_data_data* data = (delete_ext_save_data_data*) calloc(1, sizeof(delete_ext_save_data_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate delete ext save data data.");
@@ -10,10 +10,10 @@
 #include "../../core/core.h"
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
 
-    linked_list contents;
+    array_list contents;
     bool all;
 
     data_op_data deleteInfo;
@@ -24,28 +24,28 @@ static void action_delete_pending_titles_draw_top(ui_view* view, void* data, flo
 
     u32 index = deleteData->deleteInfo.processed;
     if(index < deleteData->deleteInfo.total) {
-        task_draw_pending_title_info(view, (pending_title_info*) ((list_item*) linked_list_get(&deleteData->contents, index))->data, x1, y1, x2, y2);
+        task_draw_pending_title_info(view, (pending_title_info*) ((list_item*) array_list_get(&deleteData->contents, index))->data, x1, y1, x2, y2);
     }
 }
 
 static Result action_delete_pending_titles_delete(void* data, u32 index) {
     delete_pending_titles_data* deleteData = (delete_pending_titles_data*) data;
 
-    list_item* item = (list_item*) linked_list_get(&deleteData->contents, index);
+    list_item* item = (list_item*) array_list_get(&deleteData->contents, index);
     pending_title_info* info = (pending_title_info*) item->data;
 
     Result res = 0;
 
     if(R_SUCCEEDED(res = AM_DeletePendingTitle(info->mediaType, info->titleId))) {
-        linked_list_iter iter;
-        linked_list_iterate(deleteData->items, &iter);
+        array_list_iter iter;
+        array_list_iterate(deleteData->items, &iter);
 
-        while(linked_list_iter_has_next(&iter)) {
-            list_item* currItem = (list_item*) linked_list_iter_next(&iter);
+        while(array_list_iter_has_next(&iter)) {
+            list_item* currItem = (list_item*) array_list_iter_next(&iter);
             pending_title_info* currInfo = (pending_title_info*) currItem->data;
 
             if(currInfo->titleId == info->titleId && currInfo->mediaType == info->mediaType) {
-                linked_list_iter_remove(&iter);
+                array_list_iter_remove(&iter);
                 task_free_pending_title(currItem);
             }
         }
@@ -72,7 +72,7 @@ static void action_delete_pending_titles_free_data(delete_pending_titles_data* d
         task_clear_pending_titles(&data->contents);
     }
 
-    linked_list_destroy(&data->contents);
+    array_list_destroy(&data->contents);
     free(data);
 }
 
@@ -137,7 +137,7 @@ static void action_delete_pending_titles_loading_update(ui_view* view, void* dat
         info_destroy(view);
 
         if(R_SUCCEEDED(loadingData->popData.result)) {
-            loadingData->deleteData->deleteInfo.total = linked_list_size(&loadingData->deleteData->contents);
+            loadingData->deleteData->deleteInfo.total = array_list_size(&loadingData->deleteData->contents);
             loadingData->deleteData->deleteInfo.processed = loadingData->deleteData->deleteInfo.total;
 
             prompt_display_yes_no("Confirmation", loadingData->message, COLOR_TEXT, loadingData->deleteData, action_delete_pending_titles_draw_top, action_delete_pending_titles_onresponse);
@@ -158,7 +158,7 @@ static void action_delete_pending_titles_loading_update(ui_view* view, void* dat
     snprintf(text, PROGRESS_TEXT_MAX, "Fetching pending title list...");
 }
 
-void action_delete_pending_titles(linked_list* items, list_item* selected, const char* message, bool all) {
+void action_delete_pending_titles(array_list* items, list_item* selected, const char* message, bool all) {
     delete_pending_titles_data* data = (delete_pending_titles_data*) calloc(1, sizeof(delete_pending_titles_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate delete pending titles data.");
@@ -184,7 +184,7 @@ void action_delete_pending_titles(linked_list* items, list_item* selected, const
 
     data->deleteInfo.finished = true;
 
-    linked_list_init(&data->contents);
+    array_list_init(&data->contents);
 
     if(all) {
         delete_pending_titles_loading_data* loadingData = (delete_pending_titles_loading_data*) calloc(1, sizeof(delete_pending_titles_loading_data));
@@ -211,7 +211,7 @@ void action_delete_pending_titles(linked_list* items, list_item* selected, const
 
         info_display("Loading", "Press B to cancel.", false, loadingData, action_delete_pending_titles_loading_update, action_delete_pending_titles_loading_draw_top);
     } else {
-        linked_list_add(&data->contents, selected);
+        array_list_add(&data->contents, selected);
 
         data->deleteInfo.total = 1;
         data->deleteInfo.processed = data->deleteInfo.total;
@@ -220,10 +220,10 @@ void action_delete_pending_titles(linked_list* items, list_item* selected, const
     }
 }
 
-void action_delete_pending_title(linked_list* items, list_item* selected) {
+void action_delete_pending_title(array_list* items, list_item* selected) {
     action_delete_pending_titles(items, selected, "Delete the selected pending title?", false);
 }
 
-void action_delete_all_pending_titles(linked_list* items, list_item* selected) {
+void action_delete_all_pending_titles(array_list* items, list_item* selected) {
     action_delete_pending_titles(items, selected, "Delete all pending titles?", true);
 }
\ No newline at end of file
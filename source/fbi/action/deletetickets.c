@@ -9,10 +9,10 @@
 #include "../../core/core.h"
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     bool unused;
 
-    linked_list contents;
+    array_list contents;
 
     data_op_data deleteInfo;
 } delete_tickets_data;
@@ -22,7 +22,7 @@ static void action_delete_tickets_draw_top(ui_view* view, void* data, float x1,
 
     u32 curr = deleteData->deleteInfo.processed;
     if(curr < deleteData->deleteInfo.total) {
-        task_draw_ticket_info(view, ((list_item*) linked_list_get(&deleteData->contents, curr))->data, x1, y1, x2, y2);
+        task_draw_ticket_info(view, ((list_item*) array_list_get(&deleteData->contents, curr))->data, x1, y1, x2, y2);
     }
 }
 
@@ -31,17 +31,17 @@ static Result action_delete_tickets_delete(void* data, u32 index) {
 
     Result res = 0;
 
-    u64 titleId = ((ticket_info*) ((list_item*) linked_list_get(&deleteData->contents, index))->data)->titleId;
+    u64 titleId = ((ticket_info*) ((list_item*) array_list_get(&deleteData->contents, index))->data)->titleId;
     if(R_SUCCEEDED(res = AM_DeleteTicket(titleId))) {
-        linked_list_iter iter;
-        linked_list_iterate(deleteData->items, &iter);
+        array_list_iter iter;
+        array_list_iterate(deleteData->items, &iter);
 
-        while(linked_list_iter_has_next(&iter)) {
-            list_item* item = (list_item*) linked_list_iter_next(&iter);
+        while(array_list_iter_has_next(&iter)) {
+            list_item* item = (list_item*) array_list_iter_next(&iter);
             ticket_info* currInfo = (ticket_info*) item->data;
 
             if(currInfo->titleId == titleId) {
-                linked_list_iter_remove(&iter);
+                array_list_iter_remove(&iter);
                 task_free_ticket(item);
             }
         }
@@ -68,7 +68,7 @@ static void action_delete_tickets_free_data(delete_tickets_data* data) {
         task_clear_tickets(&data->contents);
     }
 
-    linked_list_destroy(&data->contents);
+    array_list_destroy(&data->contents);
     free(data);
 }
 
@@ -133,19 +133,19 @@ static void action_delete_tickets_loading_update(ui_view* view, void* data, floa
         info_destroy(view);
 
         if(R_SUCCEEDED(loadingData->popData.result)) {
-            linked_list_iter iter;
-            linked_list_iterate(&loadingData->deleteData->contents, &iter);
-            while(linked_list_iter_has_next(&iter)) {
-                list_item* item = (list_item*) linked_list_iter_next(&iter);
+            array_list_iter iter;
+            array_list_iterate(&loadingData->deleteData->contents, &iter);
+            while(array_list_iter_has_next(&iter)) {
+                list_item* item = (list_item*) array_list_iter_next(&iter);
                 ticket_info* info = (ticket_info*) item->data;
 
                 if(info->inUse) {
-                    linked_list_iter_remove(&iter);
+                    array_list_iter_remove(&iter);
                     task_free_ticket(item);
                 }
             }
 
-            loadingData->deleteData->deleteInfo.total = linked_list_size(&loadingData->deleteData->contents);
+            loadingData->deleteData->deleteInfo.total = array_list_size(&loadingData->deleteData->contents);
             loadingData->deleteData->deleteInfo.processed = loadingData->deleteData->deleteInfo.total;
 
             prompt_display_yes_no("Confirmation", loadingData->message, COLOR_TEXT, loadingData->deleteData, action_delete_tickets_draw_top, action_delete_tickets_onresponse);
@@ -166,7 +166,7 @@ static void action_delete_tickets_loading_update(ui_view* view, void* data, floa
     snprintf(text, PROGRESS_TEXT_MAX, "Fetching ticket list...");
 }
 
-static void action_delete_tickets_internal(linked_list* items, list_item* selected, const char* message, bool unused) {
+static void action_delete_tickets_internal(array_list* items, list_item* selected, const char* message, bool unused) {
     delete_tickets_data* data = (delete_tickets_data*) calloc(1, sizeof(delete_tickets_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate delete data.");
@@ -190,7 +190,7 @@ static void action_delete_tickets_internal(linked_list* items, list_item* select
 
     data->deleteInfo.finished = false;
 
-    linked_list_init(&data->contents);
+    array_list_init(&data->contents);
 
     if(unused) {
         delete_tickets_loading_data* loadingData = (delete_tickets_loading_data*) calloc(1, sizeof(delete_tickets_loading_data));
@@ -217,7 +217,7 @@ static void action_delete_tickets_internal(linked_list* items, list_item* select
 
         info_display("Loading", "Press B to cancel.", false, loadingData, action_delete_tickets_loading_update, action_delete_tickets_loading_draw_top);
     } else {
-        linked_list_add(&data->contents, selected);
+        array_list_add(&data->contents, selected);
 
         data->deleteInfo.total = 1;
         data->deleteInfo.processed = data->deleteInfo.total;
@@ -226,10 +226,10 @@ static void action_delete_tickets_internal(linked_list* items, list_item* select
     }
 }
 
-void action_delete_ticket(linked_list* items, list_item* selected) {
+void action_delete_ticket(array_list* items, list_item* selected) {
     action_delete_tickets_internal(items, selected, "Delete the selected ticket?", false);
 }
 
-void action_delete_tickets_unused(linked_list* items, list_item* selected) {
+void action_delete_tickets_unused(array_list* items, list_item* selected) {
     action_delete_tickets_internal(items, selected, "Delete all unused tickets?", true);
 }
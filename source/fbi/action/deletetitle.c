@@ -8,7 +8,7 @@
 #include "../../core/core.h"
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
     bool ticket;
 } delete_title_data;
@@ -34,7 +34,7 @@ static void action_delete_title_update(ui_view* view, void* data, float* progres
     if(R_FAILED(res)) {
         error_display_res(info, task_draw_title_info, res, "Failed to delete title.");
     } else {
-        linked_list_remove(deleteData->items, deleteData->selected);
+        array_list_remove(deleteData->items, deleteData->selected);
         task_free_title(deleteData->selected);
 
         prompt_display_notify("Success", "Title deleted.", COLOR_TEXT, NULL, NULL, NULL);
@@ -51,7 +51,7 @@ static void action_delete_title_onresponse(ui_view* view, void* data, u32 respon
     }
 }
 
-static void action_delete_title_internal(linked_list* items, list_item* selected, const char* message, bool ticket) {
+static void action_delete_title_internal(array_list* items, list_item* selected, const char* message, bool ticket) {
     delete_title_data* data = (delete_title_data*) calloc(1, sizeof(delete_title_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate delete title data.");
@@ -66,10 +66,10 @@ static void action_delete_title_internal(linked_list* items, list_item* selected
     prompt_display_yes_no("Confirmation", message, COLOR_TEXT, data, action_delete_title_draw_top, action_delete_title_onresponse);
 }
 
-void action_delete_title(linked_list* items, list_item* selected) {
+void action_delete_title(array_list* items, list_item* selected) {
     action_delete_title_internal(items, selected, "Delete the selected title?", false);
 }
 
-void action_delete_title_ticket(linked_list* items, list_item* selected) {
+void action_delete_title_ticket(array_list* items, list_item* selected) {
     action_delete_title_internal(items, selected, "Delete the selected title and ticket?", true);
 }
\ No newline at end of file
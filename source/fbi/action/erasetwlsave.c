@@ -126,7 +126,7 @@ static void action_erase_twl_save_onresponse(ui_view* view, void* data, u32 resp
     }
 }
 
-void action_erase_twl_save(linked_list* items, list_item* selected) {
+void action_erase_twl_save(array_list* items, list_item* selected) {
     erase_twl_save_data* data = (erase_twl_save_data*) calloc(1, sizeof(erase_twl_save_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate erase TWL save data.");
@@ -148,7 +148,7 @@ static void action_export_twl_save_onresponse(ui_view* view, void* data, u32 res
     }
 }
 
-void action_export_twl_save(linked_list* items, list_item* selected) {
+void action_export_twl_save(array_list* items, list_item* selected) {
     export_twl_save_data* data = (export_twl_save_data*) calloc(1, sizeof(export_twl_save_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate export TWL save data.");
@@ -73,6 +73,6 @@ static void action_extract_smdh_onresponse(ui_view* view, void* data, u32 respon
     }
 }
 
-void action_extract_smdh(linked_list* items, list_item* selected) {
+void action_extract_smdh(array_list* items, list_item* selected) {
     prompt_display_yes_no("Confirmation", "Extract the SMDH of the selected title?", COLOR_TEXT, selected->data, task_draw_title_info, action_extract_smdh_onresponse);
 }
\ No newline at end of file
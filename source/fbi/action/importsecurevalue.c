@@ -49,6 +49,6 @@ static void action_import_secure_value_onresponse(ui_view* view, void* data, u32
     }
 }
 
-void action_import_secure_value(linked_list* items, list_item* selected) {
+void action_import_secure_value(array_list* items, list_item* selected) {
     prompt_display_yes_no("Confirmation", "Import the secure value of the selected title?", COLOR_TEXT, selected->data, task_draw_title_info, action_import_secure_value_onresponse);
 }
\ No newline at end of file
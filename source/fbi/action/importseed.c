@@ -28,6 +28,6 @@ static void action_import_seed_onresponse(ui_view* view, void* data, u32 respons
     }
 }
 
-void action_import_seed(linked_list* items, list_item* selected) {
+void action_import_seed(array_list* items, list_item* selected) {
     prompt_display_yes_no("Confirmation", "Import the seed of the selected title?", COLOR_TEXT, selected->data, task_draw_title_info, action_import_seed_onresponse);
 }
\ No newline at end of file
@@ -134,7 +134,7 @@ static void action_import_twl_save_onresponse(ui_view* view, void* data, u32 res
     }
 }
 
-void action_import_twl_save(linked_list* items, list_item* selected) {
+void action_import_twl_save(array_list* items, list_item* selected) {
     import_twl_save_data* data = (import_twl_save_data*) calloc(1, sizeof(import_twl_save_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate import TWL save data.");
@@ -10,12 +10,13 @@
 #include "../../core/core.h"
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
+    string_map itemIndex;
 
     list_item* targetItem;
     file_info* target;
 
-    linked_list contents;
+    array_list contents;
 
     bool delete;
 
@@ -33,7 +34,7 @@ static void action_install_cias_draw_top(ui_view* view, void* data, float x1, fl
 
     u32 curr = installData->installInfo.processed;
     if(curr < installData->installInfo.total) {
-        task_draw_file_info(view, ((list_item*) linked_list_get(&installData->contents, curr))->data, x1, y1, x2, y2);
+        task_draw_file_info(view, ((list_item*) array_list_get(&installData->contents, curr))->data, x1, y1, x2, y2);
     } else {
         task_draw_file_info(view, installData->target, x1, y1, x2, y2);
     }
@@ -51,7 +52,7 @@ static Result action_install_cias_make_dst_directory(void* data, u32 index) {
 static Result action_install_cias_open_src(void* data, u32 index, u32* handle) {
     install_cias_data* installData = (install_cias_data*) data;
 
-    file_info* info = (file_info*) ((list_item*) linked_list_get(&installData->contents, index))->data;
+    file_info* info = (file_info*) ((list_item*) array_list_get(&installData->contents, index))->data;
 
     Result res = 0;
 
@@ -70,7 +71,7 @@ static Result action_install_cias_open_src(void* data, u32 index, u32* handle) {
 static Result action_install_cias_close_src(void* data, u32 index, bool succeeded, u32 handle) {
     install_cias_data* installData = (install_cias_data*) data;
 
-    file_info* info = (file_info*) ((list_item*) linked_list_get(&installData->contents, index))->data;
+    file_info* info = (file_info*) ((list_item*) array_list_get(&installData->contents, index))->data;
 
     Result res = 0;
 
@@ -78,18 +79,7 @@ static Result action_install_cias_close_src(void* data, u32 index, bool succeede
         FS_Path* fsPath = fs_make_path_utf8(info->path);
         if(fsPath != NULL) {
             if(R_SUCCEEDED(FSUSER_DeleteFile(info->archive, *fsPath))) {
-                linked_list_iter iter;
-                linked_list_iterate(installData->items, &iter);
-
-                while(linked_list_iter_has_next(&iter)) {
-                    list_item* item = (list_item*) linked_list_iter_next(&iter);
-                    file_info* currInfo = (file_info*) item->data;
-
-                    if(strncmp(currInfo->path, info->path, FILE_PATH_MAX) == 0) {
-                        linked_list_iter_remove(&iter);
-                        task_free_file(item);
-                    }
-                }
+                task_remove_file(installData->items, &installData->itemIndex, info->path);
             }
 
             fs_free_path_utf8(fsPath);
@@ -114,7 +104,7 @@ static Result action_install_cias_open_dst(void* data, u32 index, void* initialR
 
     installData->n3dsContinue = false;
 
-    file_info* info = (file_info*) ((list_item*) linked_list_get(&installData->contents, index))->data;
+    file_info* info = (file_info*) ((list_item*) array_list_get(&installData->contents, index))->data;
 
     FS_MediaType dest = fs_get_title_destination(info->ciaInfo.titleId);
 
@@ -150,7 +140,7 @@ static Result action_install_cias_close_dst(void* data, u32 index, bool succeede
     if(succeeded) {
         install_cias_data* installData = (install_cias_data*) data;
 
-        file_info* info = (file_info*) ((list_item*) linked_list_get(&installData->contents, index))->data;
+        file_info* info = (file_info*) ((list_item*) array_list_get(&installData->contents, index))->data;
 
         Result res = 0;
         if(R_SUCCEEDED(res = AM_FinishCiaInstall(handle))) {
@@ -186,7 +176,8 @@ bool action_install_cias_error(void* data, u32 index, Result res, ui_view** erro
 
 static void action_install_cias_free_data(install_cias_data* data) {
     task_clear_files(&data->contents);
-    linked_list_destroy(&data->contents);
+    array_list_destroy(&data->contents);
+    string_map_destroy(&data->itemIndex);
 
     if(data->targetItem != NULL) {
         task_free_file(data->targetItem);
@@ -270,7 +261,7 @@ static void action_install_cias_loading_update(ui_view* view, void* data, float*
         info_destroy(view);
 
         if(R_SUCCEEDED(loadingData->popData.result)) {
-            loadingData->installData->installInfo.total = linked_list_size(&loadingData->installData->contents);
+            loadingData->installData->installInfo.total = array_list_size(&loadingData->installData->contents);
             loadingData->installData->installInfo.processed = loadingData->installData->installInfo.total;
 
             prompt_display_yes_no("Confirmation", loadingData->message, COLOR_TEXT, loadingData->installData, action_install_cias_draw_top, action_install_cias_onresponse);
@@ -291,7 +282,7 @@ static void action_install_cias_loading_update(ui_view* view, void* data, float*
     snprintf(text, PROGRESS_TEXT_MAX, "Fetching CIA list...");
 }
 
-static void action_install_cias_internal(linked_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData, const char* message, bool delete) {
+static void action_install_cias_internal(array_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData, const char* message, bool delete) {
     install_cias_data* data = (install_cias_data*) calloc(1, sizeof(install_cias_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate install CIAs data.");
@@ -300,6 +291,7 @@ static void action_install_cias_internal(linked_list* items, list_item* selected
     }
 
     data->items = items;
+    string_map_init(&data->itemIndex);
 
     file_info* targetInfo = (file_info*) selected->data;
     Result targetCreateRes = task_create_file_item(&data->targetItem, targetInfo->archive, targetInfo->path, targetInfo->attributes, true);
@@ -342,7 +334,7 @@ static void action_install_cias_internal(linked_list* items, list_item* selected
 
     data->installInfo.finished = true;
 
-    linked_list_init(&data->contents);
+    array_list_init(&data->contents);
 
     install_cias_loading_data* loadingData = (install_cias_loading_data*) calloc(1, sizeof(install_cias_loading_data));
     if(loadingData == NULL) {
@@ -379,18 +371,18 @@ static void action_install_cias_internal(linked_list* items, list_item* selected
     info_display("Loading", "Press B to cancel.", false, loadingData, action_install_cias_loading_update, action_install_cias_loading_draw_top);
 }
 
-void action_install_cia(linked_list* items, list_item* selected) {
+void action_install_cia(array_list* items, list_item* selected) {
     action_install_cias_internal(items, selected, NULL, NULL, "Install the selected CIA?", false);
 }
 
-void action_install_cia_delete(linked_list* items, list_item* selected) {
+void action_install_cia_delete(array_list* items, list_item* selected) {
     action_install_cias_internal(items, selected, NULL, NULL, "Install and delete the selected CIA?", true);
 }
 
-void action_install_cias(linked_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData) {
+void action_install_cias(array_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData) {
     action_install_cias_internal(items, selected, filter, filterData, "Install all CIAs in the current directory?", false);
 }
 
-void action_install_cias_delete(linked_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData) {
+void action_install_cias_delete(array_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData) {
     action_install_cias_internal(items, selected, filter, filterData, "Install and delete all CIAs in the current directory?", true);
 }
\ No newline at end of file
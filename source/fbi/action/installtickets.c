@@ -10,12 +10,13 @@
 #include "../../core/core.h"
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
+    string_map itemIndex;
 
     list_item* targetItem;
     file_info* target;
 
-    linked_list contents;
+    array_list contents;
 
     bool delete;
 
@@ -27,7 +28,7 @@ static void action_install_tickets_draw_top(ui_view* view, void* data, float x1,
 
     u32 curr = installData->installInfo.processed;
     if(curr < installData->installInfo.total) {
-        task_draw_file_info(view, ((list_item*) linked_list_get(&installData->contents, curr))->data, x1, y1, x2, y2);
+        task_draw_file_info(view, ((list_item*) array_list_get(&installData->contents, curr))->data, x1, y1, x2, y2);
     } else {
         task_draw_file_info(view, installData->target, x1, y1, x2, y2);
     }
@@ -45,7 +46,7 @@ static Result action_install_tickets_make_dst_directory(void* data, u32 index) {
 static Result action_install_tickets_open_src(void* data, u32 index, u32* handle) {
     install_tickets_data* installData = (install_tickets_data*) data;
 
-    file_info* info = (file_info*) ((list_item*) linked_list_get(&installData->contents, index))->data;
+    file_info* info = (file_info*) ((list_item*) array_list_get(&installData->contents, index))->data;
 
     Result res = 0;
 
@@ -64,7 +65,7 @@ static Result action_install_tickets_open_src(void* data, u32 index, u32* handle
 static Result action_install_tickets_close_src(void* data, u32 index, bool succeeded, u32 handle) {
     install_tickets_data* installData = (install_tickets_data*) data;
 
-    file_info* info = (file_info*) ((list_item*) linked_list_get(&installData->contents, index))->data;
+    file_info* info = (file_info*) ((list_item*) array_list_get(&installData->contents, index))->data;
 
     Result res = 0;
 
@@ -72,18 +73,7 @@ static Result action_install_tickets_close_src(void* data, u32 index, bool succe
         FS_Path* fsPath = fs_make_path_utf8(info->path);
         if(fsPath != NULL) {
             if(R_SUCCEEDED(FSUSER_DeleteFile(info->archive, *fsPath))) {
-                linked_list_iter iter;
-                linked_list_iterate(installData->items, &iter);
-
-                while(linked_list_iter_has_next(&iter)) {
-                    list_item* item = (list_item*) linked_list_iter_next(&iter);
-                    file_info* currInfo = (file_info*) item->data;
-
-                    if(strncmp(currInfo->path, info->path, FILE_PATH_MAX) == 0) {
-                        linked_list_iter_remove(&iter);
-                        task_free_file(item);
-                    }
-                }
+                task_remove_file(installData->items, &installData->itemIndex, info->path);
             }
 
             fs_free_path_utf8(fsPath);
@@ -104,7 +94,7 @@ static Result action_install_tickets_read_src(void* data, u32 handle, u32* bytes
 }
 
 static Result action_install_tickets_open_dst(void* data, u32 index, void* initialReadBlock, u64 size, u32* handle) {
-    AM_DeleteTicket(((file_info*) ((list_item*) linked_list_get(&((install_tickets_data*) data)->contents, index))->data)->ticketInfo.titleId);
+    AM_DeleteTicket(((file_info*) ((list_item*) array_list_get(&((install_tickets_data*) data)->contents, index))->data)->ticketInfo.titleId);
     return AM_InstallTicketBegin(handle);
 }
 
@@ -135,7 +125,8 @@ static bool action_install_tickets_error(void* data, u32 index, Result res, ui_v
 
 static void action_install_tickets_free_data(install_tickets_data* data) {
     task_clear_files(&data->contents);
-    linked_list_destroy(&data->contents);
+    array_list_destroy(&data->contents);
+    string_map_destroy(&data->itemIndex);
 
     if(data->targetItem != NULL) {
         task_free_file(data->targetItem);
@@ -219,7 +210,7 @@ static void action_install_tickets_loading_update(ui_view* view, void* data, flo
         info_destroy(view);
 
         if(R_SUCCEEDED(loadingData->popData.result)) {
-            loadingData->installData->installInfo.total = linked_list_size(&loadingData->installData->contents);
+            loadingData->installData->installInfo.total = array_list_size(&loadingData->installData->contents);
             loadingData->installData->installInfo.processed = loadingData->installData->installInfo.total;
 
             prompt_display_yes_no("Confirmation", loadingData->message, COLOR_TEXT, loadingData->installData, action_install_tickets_draw_top, action_install_tickets_onresponse);
@@ -240,7 +231,7 @@ static void action_install_tickets_loading_update(ui_view* view, void* data, flo
     snprintf(text, PROGRESS_TEXT_MAX, "Fetching ticket list...");
 }
 
-static void action_install_tickets_internal(linked_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData, const char* message, bool delete) {
+static void action_install_tickets_internal(array_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData, const char* message, bool delete) {
     install_tickets_data* data = (install_tickets_data*) calloc(1, sizeof(install_tickets_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate install tickets data.");
@@ -249,6 +240,7 @@ static void action_install_tickets_internal(linked_list* items, list_item* selec
     }
 
     data->items = items;
+    string_map_init(&data->itemIndex);
 
     file_info* targetInfo = (file_info*) selected->data;
     Result targetCreateRes = task_create_file_item(&data->targetItem, targetInfo->archive, targetInfo->path, targetInfo->attributes, true);
@@ -289,7 +281,7 @@ static void action_install_tickets_internal(linked_list* items, list_item* selec
 
     data->installInfo.finished = true;
 
-    linked_list_init(&data->contents);
+    array_list_init(&data->contents);
 
     install_tickets_loading_data* loadingData = (install_tickets_loading_data*) calloc(1, sizeof(install_tickets_loading_data));
     if(loadingData == NULL) {
@@ -326,18 +318,18 @@ static void action_install_tickets_internal(linked_list* items, list_item* selec
     info_display("Loading", "Press B to cancel.", false, loadingData, action_install_tickets_loading_update, action_install_tickets_loading_draw_top);
 }
 
-void action_install_ticket(linked_list* items, list_item* selected) {
+void action_install_ticket(array_list* items, list_item* selected) {
     action_install_tickets_internal(items, selected, NULL, NULL, "Install the selected ticket?", false);
 }
 
-void action_install_ticket_delete(linked_list* items, list_item* selected) {
+void action_install_ticket_delete(array_list* items, list_item* selected) {
     action_install_tickets_internal(items, selected, NULL, NULL, "Install and delete the selected ticket?", true);
 }
 
-void action_install_tickets(linked_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData) {
+void action_install_tickets(array_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData) {
     action_install_tickets_internal(items, selected, filter, filterData, "Install all tickets in the current directory?", false);
 }
 
-void action_install_tickets_delete(linked_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData) {
+void action_install_tickets_delete(array_list* items, list_item* selected, bool (*filter)(void* data, const char* name, u32 attributes), void* filterData) {
     action_install_tickets_internal(items, selected, filter, filterData, "Install and delete all tickets in the current directory?", true);
 }
\ No newline at end of file
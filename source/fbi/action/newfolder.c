@@ -9,7 +9,7 @@
 #include "../../core/core.h"
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
 } new_folder_data;
 
@@ -39,8 +39,8 @@ static void action_new_folder_onresponse(ui_view* view, void* data, SwkbdButton
         if(R_SUCCEEDED(res)) {
             list_item* folderItem = NULL;
             if(R_SUCCEEDED(task_create_file_item(&folderItem, parentDir->archive, path, FS_ATTRIBUTE_DIRECTORY, true))) {
-                linked_list_add(newFolderData->items, folderItem);
-                linked_list_sort(newFolderData->items, NULL, task_compare_files);
+                array_list_add(newFolderData->items, folderItem);
+                array_list_sort(newFolderData->items, NULL, task_compare_files);
             }
 
             prompt_display_notify("Success", "Folder created.", COLOR_TEXT, NULL, NULL, NULL);
@@ -52,7 +52,7 @@ static void action_new_folder_onresponse(ui_view* view, void* data, SwkbdButton
     free(newFolderData);
 }
 
-void action_new_folder(linked_list* items, list_item* selected) {
+void action_new_folder(array_list* items, list_item* selected) {
     new_folder_data* data = (new_folder_data*) calloc(1, sizeof(new_folder_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate new folder data.");
@@ -10,12 +10,12 @@
 #include "../../core/core.h"
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
 
     list_item* targetItem;
     file_info* target;
 
-    linked_list contents;
+    array_list contents;
 
     data_op_data pasteInfo;
 } paste_contents_data;
@@ -25,7 +25,7 @@ static void action_paste_contents_draw_top(ui_view* view, void* data, float x1,
 
     u32 curr = pasteData->pasteInfo.processed;
     if(curr < pasteData->pasteInfo.total) {
-        task_draw_file_info(view, ((list_item*) linked_list_get(&pasteData->contents, curr))->data, x1, y1, x2, y2);
+        task_draw_file_info(view, ((list_item*) array_list_get(&pasteData->contents, curr))->data, x1, y1, x2, y2);
     } else {
         task_draw_file_info(view, pasteData->target, x1, y1, x2, y2);
     }
@@ -46,13 +46,13 @@ static void action_paste_contents_get_dst_path(paste_contents_data* data, u32 in
         string_get_parent_path(baseDstPath, data->target->path, FILE_PATH_MAX);
     }
 
-    snprintf(dstPath, FILE_PATH_MAX, "%s%s", baseDstPath, ((file_info*) ((list_item*) linked_list_get(&data->contents, index))->data)->path + strlen(baseSrcPath));
+    snprintf(dstPath, FILE_PATH_MAX, "%s%s", baseDstPath, ((file_info*) ((list_item*) array_list_get(&data->contents, index))->data)->path + strlen(baseSrcPath));
 }
 
 static Result action_paste_contents_is_src_directory(void* data, u32 index, bool* isDirectory) {
     paste_contents_data* pasteData = (paste_contents_data*) data;
 
-    *isDirectory = (bool) (((file_info*) ((list_item*) linked_list_get(&pasteData->contents, index))->data)->attributes & FS_ATTRIBUTE_DIRECTORY);
+    *isDirectory = (bool) (((file_info*) ((list_item*) array_list_get(&pasteData->contents, index))->data)->attributes & FS_ATTRIBUTE_DIRECTORY);
     return 0;
 }
 
@@ -61,7 +61,7 @@ static Result action_paste_contents_make_dst_directory(void* data, u32 index) {
 
     Result res = 0;
 
-    u32 attributes = ((file_info*) ((list_item*) linked_list_get(&pasteData->contents, index))->data)->attributes;
+    u32 attributes = ((file_info*) ((list_item*) array_list_get(&pasteData->contents, index))->data)->attributes;
 
     char dstPath[FILE_PATH_MAX];
     action_paste_contents_get_dst_path(pasteData, index, dstPath);
@@ -85,7 +85,7 @@ static Result action_paste_contents_make_dst_directory(void* data, u32 index) {
             if(strncmp(parentPath, baseDstPath, FILE_PATH_MAX) == 0) {
                 list_item* dstItem = NULL;
                 if(R_SUCCEEDED(res) && R_SUCCEEDED(task_create_file_item(&dstItem, pasteData->target->archive, dstPath, attributes, true))) {
-                    linked_list_add(pasteData->items, dstItem);
+                    array_list_add(pasteData->items, dstItem);
                 }
             }
         }
@@ -103,7 +103,7 @@ static Result action_paste_contents_open_src(void* data, u32 index, u32* handle)
 
     Result res = 0;
 
-    FS_Path* fsPath = fs_make_path_utf8(((file_info*) ((list_item*) linked_list_get(&pasteData->contents, index))->data)->path);
+    FS_Path* fsPath = fs_make_path_utf8(((file_info*) ((list_item*) array_list_get(&pasteData->contents, index))->data)->path);
     if(fsPath != NULL) {
         res = FSUSER_OpenFile(handle, clipboard_get_archive(), *fsPath, FS_OPEN_READ, 0);
 
@@ -141,22 +141,22 @@ static Result action_paste_contents_open_dst(void* data, u32 index, void* initia
         if(R_SUCCEEDED(FSUSER_OpenFile(&currHandle, pasteData->target->archive, *fsPath, FS_OPEN_READ, 0))) {
             FSFILE_Close(currHandle);
             if(R_SUCCEEDED(res = FSUSER_DeleteFile(pasteData->target->archive, *fsPath))) {
-                linked_list_iter iter;
-                linked_list_iterate(pasteData->items, &iter);
+                array_list_iter iter;
+                array_list_iterate(pasteData->items, &iter);
 
-                while(linked_list_iter_has_next(&iter)) {
-                    list_item* item = (list_item*) linked_list_iter_next(&iter);
+                while(array_list_iter_has_next(&iter)) {
+                    list_item* item = (list_item*) array_list_iter_next(&iter);
                     file_info* currInfo = (file_info*) item->data;
 
                     if(strncmp(currInfo->path, dstPath, FILE_PATH_MAX) == 0) {
-                        linked_list_iter_remove(&iter);
+                        array_list_iter_remove(&iter);
                         task_free_file(item);
                     }
                 }
             }
         }
 
-        if(R_SUCCEEDED(res) && R_SUCCEEDED(res = FSUSER_CreateFile(pasteData->target->archive, *fsPath, ((file_info*) ((list_item*) linked_list_get(&pasteData->contents, index))->data)->attributes & ~FS_ATTRIBUTE_READ_ONLY, size))) {
+        if(R_SUCCEEDED(res) && R_SUCCEEDED(res = FSUSER_CreateFile(pasteData->target->archive, *fsPath, ((file_info*) ((list_item*) array_list_get(&pasteData->contents, index))->data)->attributes & ~FS_ATTRIBUTE_READ_ONLY, size))) {
             res = FSUSER_OpenFile(handle, pasteData->target->archive, *fsPath, FS_OPEN_WRITE, 0);
         }
 
@@ -189,8 +189,8 @@ static Result action_paste_contents_close_dst(void* data, u32 index, bool succee
 
         if(strncmp(parentPath, baseDstPath, FILE_PATH_MAX) == 0) {
             list_item* dstItem = NULL;
-            if(R_SUCCEEDED(task_create_file_item(&dstItem, pasteData->target->archive, dstPath, ((file_info*) ((list_item*) linked_list_get(&pasteData->contents, index))->data)->attributes & ~FS_ATTRIBUTE_READ_ONLY, true))) {
-                linked_list_add(pasteData->items, dstItem);
+            if(R_SUCCEEDED(task_create_file_item(&dstItem, pasteData->target->archive, dstPath, ((file_info*) ((list_item*) array_list_get(&pasteData->contents, index))->data)->attributes & ~FS_ATTRIBUTE_READ_ONLY, true))) {
+                array_list_add(pasteData->items, dstItem);
             }
         }
     }
@@ -217,7 +217,7 @@ static bool action_paste_contents_error(void* data, u32 index, Result res, ui_vi
 
 static void action_paste_contents_free_data(paste_contents_data* data) {
     task_clear_files(&data->contents);
-    linked_list_destroy(&data->contents);
+    array_list_destroy(&data->contents);
 
     if(data->targetItem != NULL) {
         task_free_file(data->targetItem);
@@ -234,7 +234,7 @@ static void action_paste_contents_update(ui_view* view, void* data, float* progr
     if(pasteData->pasteInfo.finished) {
         FSUSER_ControlArchive(pasteData->target->archive, ARCHIVE_ACTION_COMMIT_SAVE_DATA, NULL, 0, NULL, 0);
 
-        linked_list_sort(pasteData->items, NULL, task_compare_files);
+        array_list_sort(pasteData->items, NULL, task_compare_files);
 
         ui_pop();
         info_destroy(view);
@@ -297,7 +297,7 @@ static void action_paste_contents_loading_update(ui_view* view, void* data, floa
         info_destroy(view);
 
         if(R_SUCCEEDED(loadingData->popData.result)) {
-            loadingData->pasteData->pasteInfo.total = linked_list_size(&loadingData->pasteData->contents);
+            loadingData->pasteData->pasteInfo.total = array_list_size(&loadingData->pasteData->contents);
             loadingData->pasteData->pasteInfo.processed = loadingData->pasteData->pasteInfo.total;
 
             prompt_display_yes_no("Confirmation", "Paste clipboard contents to the current directory?", COLOR_TEXT, loadingData->pasteData, action_paste_contents_draw_top, action_paste_contents_onresponse);
@@ -318,7 +318,7 @@ static void action_paste_contents_loading_update(ui_view* view, void* data, floa
     snprintf(text, PROGRESS_TEXT_MAX, "Fetching clipboard content list...");
 }
 
-void action_paste_contents(linked_list* items, list_item* selected) {
+void action_paste_contents(array_list* items, list_item* selected) {
     if(!clipboard_has_contents()) {
         prompt_display_notify("Failure", "Clipboard empty.", COLOR_TEXT, NULL, NULL, NULL);
         return;
@@ -370,7 +370,7 @@ void action_paste_contents(linked_list* items, list_item* selected) {
 
     data->pasteInfo.finished = true;
 
-    linked_list_init(&data->contents);
+    array_list_init(&data->contents);
 
     paste_contents_loading_data* loadingData = (paste_contents_loading_data*) calloc(1, sizeof(paste_contents_loading_data));
     if(loadingData == NULL) {
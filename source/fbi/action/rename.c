@@ -10,7 +10,7 @@
 #include "../../core/core.h"
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
 } rename_data;
 
@@ -56,15 +56,12 @@ static void action_rename_onresponse(ui_view* view, void* data, SwkbdButton butt
             res = R_APP_OUT_OF_MEMORY;
         }
 
-        if(R_SUCCEEDED(res)) {
+        if(R_SUCCEEDED(res) && R_SUCCEEDED(res = task_set_file_path(targetInfo, dstPath))) {
             if(strncmp(selected->name, "<current directory>", LIST_ITEM_NAME_MAX) != 0 && strncmp(selected->name, "<current file>", LIST_ITEM_NAME_MAX) != 0) {
                 string_copy(selected->name, fileName, LIST_ITEM_NAME_MAX);
             }
 
-            string_copy(targetInfo->name, fileName, FILE_NAME_MAX);
-            string_copy(targetInfo->path, dstPath, FILE_PATH_MAX);
-
-            linked_list_sort(renameData->items, NULL, task_compare_files);
+            array_list_sort(renameData->items, NULL, task_compare_files);
 
             prompt_display_notify("Success", "Renamed.", COLOR_TEXT, NULL, NULL, NULL);
         } else {
@@ -75,7 +72,7 @@ static void action_rename_onresponse(ui_view* view, void* data, SwkbdButton butt
     free(renameData);
 }
 
-void action_rename(linked_list* items, list_item* selected) {
+void action_rename(array_list* items, list_item* selected) {
     rename_data* data = (rename_data*) calloc(1, sizeof(rename_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate rename data.");
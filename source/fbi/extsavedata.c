@@ -23,10 +23,11 @@ typedef struct {
     bool sortByName;
 
     bool populated;
+    bool sorted;
 } extsavedata_data;
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
 } extsavedata_action_data;
 
@@ -34,7 +35,7 @@ static void extsavedata_action_draw_top(ui_view* view, void* data, float x1, flo
     task_draw_ext_save_data_info(view, ((extsavedata_action_data*) data)->selected->data, x1, y1, x2, y2);
 }
 
-static void extsavedata_action_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void extsavedata_action_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     extsavedata_action_data* actionData = (extsavedata_action_data*) data;
 
     if(hidKeysDown() & KEY_B) {
@@ -47,7 +48,7 @@ static void extsavedata_action_update(ui_view* view, void* data, linked_list* it
     }
 
     if(selected != NULL && selected->data != NULL && (selectedTouched || (hidKeysDown() & KEY_A))) {
-        void(*action)(linked_list*, list_item*) = (void(*)(linked_list*, list_item*)) selected->data;
+        void(*action)(array_list*, list_item*) = (void(*)(array_list*, list_item*)) selected->data;
 
         ui_pop();
         list_destroy(view);
@@ -59,14 +60,14 @@ static void extsavedata_action_update(ui_view* view, void* data, linked_list* it
         return;
     }
 
-    if(linked_list_size(items) == 0) {
-        linked_list_add(items, &browse_user_save_data);
-        linked_list_add(items, &browse_spotpass_save_data);
-        linked_list_add(items, &delete_save_data);
+    if(array_list_size(items) == 0) {
+        array_list_add(items, &browse_user_save_data);
+        array_list_add(items, &browse_spotpass_save_data);
+        array_list_add(items, &delete_save_data);
     }
 }
 
-static void extsavedata_action_open(linked_list* items, list_item* selected) {
+static void extsavedata_action_open(array_list* items, list_item* selected) {
     extsavedata_action_data* data = (extsavedata_action_data*) calloc(1, sizeof(extsavedata_action_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate ext save data action data.");
@@ -80,27 +81,27 @@ static void extsavedata_action_open(linked_list* items, list_item* selected) {
     list_display("Ext Save Data Action", "A: Select, B: Return", data, extsavedata_action_update, extsavedata_action_draw_top);
 }
 
-static void extsavedata_options_add_entry(linked_list* items, const char* name, bool* val) {
+static void extsavedata_options_add_entry(array_list* items, const char* name, bool* val) {
     list_item* item = (list_item*) calloc(1, sizeof(list_item));
     if(item != NULL) {
         snprintf(item->name, LIST_ITEM_NAME_MAX, "%s", name);
         item->color = *val ? COLOR_ENABLED : COLOR_DISABLED;
         item->data = val;
 
-        linked_list_add(items, item);
+        array_list_add(items, item);
     }
 }
 
-static void extsavedata_options_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void extsavedata_options_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     extsavedata_data* listData = (extsavedata_data*) data;
 
     if(hidKeysDown() & KEY_B) {
-        linked_list_iter iter;
-        linked_list_iterate(items, &iter);
+        array_list_iter iter;
+        array_list_iterate(items, &iter);
 
-        while(linked_list_iter_has_next(&iter)) {
-            free(linked_list_iter_next(&iter));
-            linked_list_iter_remove(&iter);
+        while(array_list_iter_has_next(&iter)) {
+            free(array_list_iter_next(&iter));
+            array_list_iter_remove(&iter);
         }
 
         ui_pop();
@@ -120,10 +121,10 @@ static void extsavedata_options_update(ui_view* view, void* data, linked_list* i
                 listData->sortById = false;
             }
 
-            linked_list_iter iter;
-            linked_list_iterate(items, &iter);
-            while(linked_list_iter_has_next(&iter)) {
-                list_item* item = (list_item*) linked_list_iter_next(&iter);
+            array_list_iter iter;
+            array_list_iterate(items, &iter);
+            while(array_list_iter_has_next(&iter)) {
+                list_item* item = (list_item*) array_list_iter_next(&iter);
 
                 item->color = *(bool*) item->data ? COLOR_ENABLED : COLOR_DISABLED;
             }
@@ -131,10 +132,14 @@ static void extsavedata_options_update(ui_view* view, void* data, linked_list* i
             selected->color = *val ? COLOR_ENABLED : COLOR_DISABLED;
         }
 
-        listData->populated = false;
+        if(val == &listData->sortById || val == &listData->sortByName) {
+            listData->sorted = false;
+        } else {
+            listData->populated = false;
+        }
     }
 
-    if(linked_list_size(items) == 0) {
+    if(array_list_size(items) == 0) {
         extsavedata_options_add_entry(items, "Show SD", &listData->showSD);
         extsavedata_options_add_entry(items, "Show NAND", &listData->showNAND);
         extsavedata_options_add_entry(items, "Sort by ID", &listData->sortById);
@@ -152,7 +157,43 @@ static void extsavedata_draw_top(ui_view* view, void* data, float x1, float y1,
     }
 }
 
-static void extsavedata_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static int extsavedata_compare(void* data, const void* p1, const void* p2) {
+    extsavedata_data* listData = (extsavedata_data*) data;
+
+    list_item* info1 = (list_item*) p1;
+    list_item* info2 = (list_item*) p2;
+
+    ext_save_data_info* data1 = (ext_save_data_info*) info1->data;
+    ext_save_data_info* data2 = (ext_save_data_info*) info2->data;
+
+    if(data1->mediaType > data2->mediaType) {
+        return -1;
+    } else if(data1->mediaType < data2->mediaType) {
+        return 1;
+    } else {
+        if(listData->sortById) {
+            u64 id1 = data1->extSaveDataId;
+            u64 id2 = data2->extSaveDataId;
+
+            return id1 > id2 ? 1 : id1 < id2 ? -1 : 0;
+        } else if(listData->sortByName) {
+            bool title1HasName = data1->hasMeta && !string_is_empty(data1->meta.shortDescription);
+            bool title2HasName = data2->hasMeta && !string_is_empty(data2->meta.shortDescription);
+
+            if(title1HasName && !title2HasName) {
+                return -1;
+            } else if(!title1HasName && title2HasName) {
+                return 1;
+            } else {
+                return strncasecmp(info1->name, info2->name, sizeof(info1->name));
+            }
+        } else {
+            return 0;
+        }
+    }
+}
+
+static void extsavedata_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     extsavedata_data* listData = (extsavedata_data*) data;
 
     if(hidKeysDown() & KEY_B) {
@@ -192,6 +233,17 @@ static void extsavedata_update(ui_view* view, void* data, linked_list* items, li
         }
 
         listData->populated = true;
+        listData->sorted = true;
+    }
+
+    if(!listData->sorted) {
+        if(listData->populateData.finished) {
+            array_list_sort(items, listData, extsavedata_compare);
+        } else {
+            listData->populated = false;
+        }
+
+        listData->sorted = true;
     }
 
     if(listData->populateData.finished && R_FAILED(listData->populateData.result)) {
@@ -216,42 +268,6 @@ static bool extsavedata_filter(void* data, u64 titleId, FS_MediaType mediaType)
     }
 }
 
-static int extsavedata_compare(void* data, const void* p1, const void* p2) {
-    extsavedata_data* listData = (extsavedata_data*) data;
-
-    list_item* info1 = (list_item*) p1;
-    list_item* info2 = (list_item*) p2;
-
-    ext_save_data_info* data1 = (ext_save_data_info*) info1->data;
-    ext_save_data_info* data2 = (ext_save_data_info*) info2->data;
-
-    if(data1->mediaType > data2->mediaType) {
-        return -1;
-    } else if(data1->mediaType < data2->mediaType) {
-        return 1;
-    } else {
-        if(listData->sortById) {
-            u64 id1 = data1->extSaveDataId;
-            u64 id2 = data2->extSaveDataId;
-
-            return id1 > id2 ? 1 : id1 < id2 ? -1 : 0;
-        } else if(listData->sortByName) {
-            bool title1HasName = data1->hasMeta && !string_is_empty(data1->meta.shortDescription);
-            bool title2HasName = data2->hasMeta && !string_is_empty(data2->meta.shortDescription);
-
-            if(title1HasName && !title2HasName) {
-                return -1;
-            } else if(!title1HasName && title2HasName) {
-                return 1;
-            } else {
-                return strncasecmp(info1->name, info2->name, sizeof(info1->name));
-            }
-        } else {
-            return 0;
-        }
-    }
-}
-
 void extsavedata_open() {
     extsavedata_data* data = (extsavedata_data*) calloc(1, sizeof(extsavedata_data));
     if(data == NULL) {
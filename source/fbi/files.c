@@ -54,7 +54,7 @@ typedef struct {
 } files_data;
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
     files_data* parent;
 
@@ -84,7 +84,7 @@ static void files_action_draw_top(ui_view* view, void* data, float x1, float y1,
     task_draw_file_info(view, ((files_action_data*) data)->selected->data, x1, y1, x2, y2);
 }
 
-static void files_action_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void files_action_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     files_action_data* actionData = (files_action_data*) data;
 
     if(hidKeysDown() & KEY_B) {
@@ -112,11 +112,11 @@ static void files_action_update(ui_view* view, void* data, linked_list* items, l
                 error_display_res(info, task_draw_file_info, res, "Failed to copy to clipboard.");
             }
         } else if(selected == &install_all_cias || selected == &install_and_delete_all_cias || selected == &install_all_tickets || selected == &install_and_delete_all_tickets) {
-            void (*filteredAction)(linked_list*, list_item*, bool (*)(void*, const char*, u32), void*) = action;
+            void (*filteredAction)(array_list*, list_item*, bool (*)(void*, const char*, u32), void*) = action;
 
             filteredAction(actionData->items, actionData->selected, files_filter, actionData->parent);
         } else {
-            void (*normalAction)(linked_list*, list_item*) = action;
+            void (*normalAction)(array_list*, list_item*) = action;
 
             normalAction(actionData->items, actionData->selected);
         }
@@ -126,49 +126,49 @@ static void files_action_update(ui_view* view, void* data, linked_list* items, l
         return;
     }
 
-    if(linked_list_size(items) == 0) {
+    if(array_list_size(items) == 0) {
         file_info* info = (file_info*) actionData->selected->data;
 
         if(info->attributes & FS_ATTRIBUTE_DIRECTORY) {
             if(actionData->containsCias) {
-                linked_list_add(items, &install_all_cias);
-                linked_list_add(items, &install_and_delete_all_cias);
-                linked_list_add(items, &delete_all_cias);
+                array_list_add(items, &install_all_cias);
+                array_list_add(items, &install_and_delete_all_cias);
+                array_list_add(items, &delete_all_cias);
             }
 
             if(actionData->containsTickets) {
-                linked_list_add(items, &install_all_tickets);
-                linked_list_add(items, &install_and_delete_all_tickets);
-                linked_list_add(items, &delete_all_tickets);
+                array_list_add(items, &install_all_tickets);
+                array_list_add(items, &install_and_delete_all_tickets);
+                array_list_add(items, &delete_all_tickets);
             }
 
-            linked_list_add(items, &copy_all_contents);
-            linked_list_add(items, &delete_all_contents);
+            array_list_add(items, &copy_all_contents);
+            array_list_add(items, &delete_all_contents);
 
-            linked_list_add(items, &new_folder);
+            array_list_add(items, &new_folder);
 
-            linked_list_add(items, &delete_dir);
+            array_list_add(items, &delete_dir);
         } else {
             if(info->isCia) {
-                linked_list_add(items, &install_cia);
-                linked_list_add(items, &install_and_delete_cia);
+                array_list_add(items, &install_cia);
+                array_list_add(items, &install_and_delete_cia);
             }
 
             if(info->isTicket) {
-                linked_list_add(items, &install_ticket);
-                linked_list_add(items, &install_and_delete_ticket);
+                array_list_add(items, &install_ticket);
+                array_list_add(items, &install_and_delete_ticket);
             }
 
-            linked_list_add(items, &delete_file);
+            array_list_add(items, &delete_file);
         }
 
-        linked_list_add(items, &rename_opt);
-        linked_list_add(items, &copy);
-        linked_list_add(items, &paste);
+        array_list_add(items, &rename_opt);
+        array_list_add(items, &copy);
+        array_list_add(items, &paste);
     }
 }
 
-static void files_action_open(linked_list* items, list_item* selected, files_data* parent) {
+static void files_action_open(array_list* items, list_item* selected, files_data* parent) {
     files_action_data* data = (files_action_data*) calloc(1, sizeof(files_action_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate files action data.");
@@ -183,11 +183,11 @@ static void files_action_open(linked_list* items, list_item* selected, files_dat
     data->containsCias = false;
     data->containsTickets = false;
 
-    linked_list_iter iter;
-    linked_list_iterate(data->items, &iter);
+    array_list_iter iter;
+    array_list_iterate(data->items, &iter);
 
-    while(linked_list_iter_has_next(&iter)) {
-        file_info* info = (file_info*) ((list_item*) linked_list_iter_next(&iter))->data;
+    while(array_list_iter_has_next(&iter)) {
+        file_info* info = (file_info*) ((list_item*) array_list_iter_next(&iter))->data;
 
         if(info->isCia) {
             data->containsCias = true;
@@ -199,27 +199,27 @@ static void files_action_open(linked_list* items, list_item* selected, files_dat
     list_display((((file_info*) selected->data)->attributes & FS_ATTRIBUTE_DIRECTORY) ? "Directory Action" : "File Action", "A: Select, B: Return", data, files_action_update, files_action_draw_top);
 }
 
-static void files_options_add_entry(linked_list* items, const char* name, bool* val) {
+static void files_options_add_entry(array_list* items, const char* name, bool* val) {
     list_item* item = (list_item*) calloc(1, sizeof(list_item));
     if(item != NULL) {
         snprintf(item->name, LIST_ITEM_NAME_MAX, "%s", name);
         item->color = *val ? COLOR_ENABLED : COLOR_DISABLED;
         item->data = val;
 
-        linked_list_add(items, item);
+        array_list_add(items, item);
     }
 }
 
-static void files_options_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void files_options_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     files_data* listData = (files_data*) data;
 
     if(hidKeysDown() & KEY_B) {
-        linked_list_iter iter;
-        linked_list_iterate(items, &iter);
+        array_list_iter iter;
+        array_list_iterate(items, &iter);
 
-        while(linked_list_iter_has_next(&iter)) {
-            free(linked_list_iter_next(&iter));
-            linked_list_iter_remove(&iter);
+        while(array_list_iter_has_next(&iter)) {
+            free(array_list_iter_next(&iter));
+            array_list_iter_remove(&iter);
         }
 
         ui_pop();
@@ -237,7 +237,7 @@ static void files_options_update(ui_view* view, void* data, linked_list* items,
         listData->populated = false;
     }
 
-    if(linked_list_size(items) == 0) {
+    if(array_list_size(items) == 0) {
         files_options_add_entry(items, "Show hidden", &listData->showHidden);
         files_options_add_entry(items, "Show directories", &listData->showDirectories);
         files_options_add_entry(items, "Show files", &listData->showFiles);
@@ -256,7 +256,7 @@ static void files_draw_top(ui_view* view, void* data, float x1, float y1, float
     }
 }
 
-static void files_repopulate(files_data* listData, linked_list* items) {
+static void files_repopulate(files_data* listData, array_list* items) {
     if(!listData->populateData.finished) {
         svcSignalEvent(listData->populateData.cancelEvent);
         while(!listData->populateData.finished) {
@@ -276,7 +276,7 @@ static void files_repopulate(files_data* listData, linked_list* items) {
     listData->populated = true;
 }
 
-static void files_navigate(files_data* listData, linked_list* items, const char* path) {
+static void files_navigate(files_data* listData, array_list* items, const char* path) {
     string_copy(listData->currDir, path, FILE_PATH_MAX);
 
     listData->populated = false;
@@ -303,12 +303,12 @@ static void files_free_data(files_data* data) {
     free(data);
 }
 
-static void files_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void files_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     files_data* listData = (files_data*) data;
 
     if(listData->populated) {
         // Detect whether the current directory was renamed by an action.
-        list_item* currDirItem = linked_list_get(items, 0);
+        list_item* currDirItem = array_list_get(items, 0);
         if(currDirItem != NULL && strncmp(listData->currDir, ((file_info*) currDirItem->data)->path, FILE_PATH_MAX) != 0) {
             string_copy(listData->currDir, ((file_info*) currDirItem->data)->path, FILE_PATH_MAX);
         }
@@ -31,7 +31,7 @@ static void mainmenu_draw_top(ui_view* view, void* data, float x1, float y1, flo
     screen_draw_texture(TEXTURE_LOGO, logoX, logoY, logoWidth, logoHeight);
 }
 
-static void mainmenu_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void mainmenu_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     if(hidKeysDown() & KEY_START) {
         ui_pop();
         list_destroy(view);
@@ -44,20 +44,20 @@ static void mainmenu_update(ui_view* view, void* data, linked_list* items, list_
         return;
     }
 
-    if(linked_list_size(items) == 0) {
-        linked_list_add(items, &sd);
-        linked_list_add(items, &ctr_nand);
-        linked_list_add(items, &twl_nand);
-        linked_list_add(items, &twl_photo);
-        linked_list_add(items, &twl_sound);
-        linked_list_add(items, &dump_nand);
-        linked_list_add(items, &titles);
-        linked_list_add(items, &pending_titles);
-        linked_list_add(items, &tickets);
-        linked_list_add(items, &ext_save_data);
-        linked_list_add(items, &system_save_data);
-        linked_list_add(items, &remote_install);
-        linked_list_add(items, &update);
+    if(array_list_size(items) == 0) {
+        array_list_add(items, &sd);
+        array_list_add(items, &ctr_nand);
+        array_list_add(items, &twl_nand);
+        array_list_add(items, &twl_photo);
+        array_list_add(items, &twl_sound);
+        array_list_add(items, &dump_nand);
+        array_list_add(items, &titles);
+        array_list_add(items, &pending_titles);
+        array_list_add(items, &tickets);
+        array_list_add(items, &ext_save_data);
+        array_list_add(items, &system_save_data);
+        array_list_add(items, &remote_install);
+        array_list_add(items, &update);
     }
 }
 
@@ -19,7 +19,7 @@ typedef struct {
 } pendingtitles_data;
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
 } pendingtitles_action_data;
 
@@ -27,7 +27,7 @@ static void pendingtitles_action_draw_top(ui_view* view, void* data, float x1, f
     task_draw_pending_title_info(view, ((pendingtitles_action_data*) data)->selected->data, x1, y1, x2, y2);
 }
 
-static void pendingtitles_action_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void pendingtitles_action_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     pendingtitles_action_data* actionData = (pendingtitles_action_data*) data;
 
     if(hidKeysDown() & KEY_B) {
@@ -40,7 +40,7 @@ static void pendingtitles_action_update(ui_view* view, void* data, linked_list*
     }
 
     if(selected != NULL && selected->data != NULL && (selectedTouched || (hidKeysDown() & KEY_A))) {
-        void(*action)(linked_list*, list_item*) = (void(*)(linked_list*, list_item*)) selected->data;
+        void(*action)(array_list*, list_item*) = (void(*)(array_list*, list_item*)) selected->data;
 
         ui_pop();
         list_destroy(view);
@@ -52,13 +52,13 @@ static void pendingtitles_action_update(ui_view* view, void* data, linked_list*
         return;
     }
 
-    if(linked_list_size(items) == 0) {
-        linked_list_add(items, &delete_pending_title);
-        linked_list_add(items, &delete_all_pending_titles);
+    if(array_list_size(items) == 0) {
+        array_list_add(items, &delete_pending_title);
+        array_list_add(items, &delete_all_pending_titles);
     }
 }
 
-static void pendingtitles_action_open(linked_list* items, list_item* selected) {
+static void pendingtitles_action_open(array_list* items, list_item* selected) {
     pendingtitles_action_data* data = (pendingtitles_action_data*) calloc(1, sizeof(pendingtitles_action_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate pending titles action data.");
@@ -78,7 +78,7 @@ static void pendingtitles_draw_top(ui_view* view, void* data, float x1, float y1
     }
 }
 
-static void pendingtitles_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void pendingtitles_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     pendingtitles_data* listData = (pendingtitles_data*) data;
 
     if(hidKeysDown() & KEY_B) {
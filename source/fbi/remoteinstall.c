@@ -3,6 +3,7 @@
 #include <fcntl.h>
 #include <malloc.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
@@ -242,15 +243,491 @@ static void remoteinstall_receive_urls_network() {
 #define QR_IMAGE_WIDTH 400
 #define QR_IMAGE_HEIGHT 240
 
+#define QR_DECODE_EVENT_QUIT 0
+#define QR_DECODE_EVENT_FRAME 1
+
+#define QR_DECODE_EVENT_COUNT 2
+
+#define QR_THUMB_STEP 16
+#define QR_THUMB_WIDTH (QR_IMAGE_WIDTH / QR_THUMB_STEP)
+#define QR_THUMB_HEIGHT (QR_IMAGE_HEIGHT / QR_THUMB_STEP)
+#define QR_THUMB_SKIPS_MAX 15
+
+#define QR_ROI_ALIGN 16
+#define QR_ROI_MIN_CAPSTONES 3
+#define QR_FULL_SCAN_INTERVAL 8
+
+#define QR_COARSE_SCALE 2
+#define QR_COARSE_WIDTH (QR_IMAGE_WIDTH / QR_COARSE_SCALE)
+#define QR_COARSE_HEIGHT (QR_IMAGE_HEIGHT / QR_COARSE_SCALE)
+#define QR_COARSE_MISS_INTERVAL 2
+
+// URL lists too long for one code can be split across several, either with QR structured append
+// or with codes of the form "fbi:<id>:<part>/<count>:<urls>", parts counting from 1.
+#define QR_PART_PREFIX "fbi:"
+#define QR_PART_ID_MAX 16
+#define QR_PARTS_MAX 16
+
+// Frames are decoded on a worker thread; frames arriving mid-decode collapse into one wakeup.
+// decodeMutex keeps the worker out of the camera buffer while capture is stopped or restarted.
 typedef struct {
     struct quirc* qrContext;
     u32 tex;
 
     bool capturing;
     capture_cam_data captureInfo;
+
+    Thread decodeThread;
+    Handle decodeMutex;
+    Handle decodeEvents[QR_DECODE_EVENT_COUNT];
+
+    volatile bool decoded;
+    char* payload;
+
+    volatile u32 partsScanned;
+    volatile u32 partCount;
+
+    // Owned by the decode thread.
+    struct quirc* coarseContext;
+    u32 coarseMisses;
+
+    char partId[QR_PART_ID_MAX];
+    int partParity;
+    char* parts[QR_PARTS_MAX];
+
+    struct quirc* roiContext;
+    bool roiValid;
+    int roiX;
+    int roiY;
+    int roiW;
+    int roiH;
+    u32 roiScans;
+
+    bool thumbValid;
+    u8 thumb[QR_THUMB_WIDTH * QR_THUMB_HEIGHT];
+    u32 thumbSkips;
+
+#ifdef DEBUG_STATS
+    u64 statsStart;
+    u64 statsBusy;
+    u64 statsLatency;
+    u32 statsScans;
+
+    volatile u32 latencyMs;
+    volatile u32 cpuPercent;
+#endif
 } remoteinstall_qr_data;
 
+#define QR_LUMA(px) ((u8) ((77 * (((px) >> 8) & 0xF8) + 150 * (((px) >> 3) & 0xFC) + 29 * (((px) << 3) & 0xF8)) >> 8))
+
+// Converts RGB565 to 8-bit luma in a single row-major pass, two pixels per load.
+static void remoteinstall_qr_to_luma(u8* dst, const u16* src, u32 count) {
+    u32 i = 0;
+
+    if(((u32) src & 3) == 0) {
+        const u32* pairs = (const u32*) src;
+        for(; i + 2 <= count; i += 2) {
+            u32 pair = *pairs++;
+
+            dst[i] = QR_LUMA(pair & 0xFFFF);
+            dst[i + 1] = QR_LUMA(pair >> 16);
+        }
+    }
+
+    for(; i < count; i++) {
+        dst[i] = QR_LUMA(src[i]);
+    }
+}
+
+static void remoteinstall_qr_convert(u8* dst, const u16* src, int x, int y, int w, int h) {
+    for(int row = 0; row < h; row++) {
+        remoteinstall_qr_to_luma(dst + row * w, src + (y + row) * QR_IMAGE_WIDTH + x, (u32) w);
+    }
+}
+
+// Samples a coarse thumbnail of the frame and reports whether it moved by more than one
+// level anywhere since the last scanned frame; an exact hash would never match between frames
+// due to sensor noise. Comparing against the last scan rather than the previous frame keeps slow
+// drift from going unnoticed, and after QR_THUMB_SKIPS_MAX skipped frames one is scanned anyway.
+static bool remoteinstall_qr_frame_changed(remoteinstall_qr_data* data, const u16* src) {
+    bool changed = !data->thumbValid || data->thumbSkips >= QR_THUMB_SKIPS_MAX;
+
+    u8 thumb[QR_THUMB_WIDTH * QR_THUMB_HEIGHT];
+    for(u32 y = 0; y < QR_THUMB_HEIGHT; y++) {
+        const u16* row = src + (y * QR_THUMB_STEP + QR_THUMB_STEP / 2) * QR_IMAGE_WIDTH + QR_THUMB_STEP / 2;
+
+        for(u32 x = 0; x < QR_THUMB_WIDTH; x++) {
+            u32 i = y * QR_THUMB_WIDTH + x;
+
+            thumb[i] = (u8) ((row[x * QR_THUMB_STEP] >> 7) & 0xF);
+            if(thumb[i] > data->thumb[i] + 1 || thumb[i] + 1 < data->thumb[i]) {
+                changed = true;
+            }
+        }
+    }
+
+    if(changed) {
+        memcpy(data->thumb, thumb, sizeof(thumb));
+        data->thumbValid = true;
+        data->thumbSkips = 0;
+    } else {
+        data->thumbSkips++;
+    }
+
+    return changed;
+}
+
+static void remoteinstall_qr_reset_parts(remoteinstall_qr_data* data) {
+    for(u32 i = 0; i < QR_PARTS_MAX; i++) {
+        if(data->parts[i] != NULL) {
+            free(data->parts[i]);
+            data->parts[i] = NULL;
+        }
+    }
+
+    data->partId[0] = '\0';
+    data->partParity = -1;
+
+    data->partsScanned = 0;
+    data->partCount = 0;
+}
+
+// Joins the collected parts into the payload, checking the structured append parity if present.
+static bool remoteinstall_qr_join_parts(remoteinstall_qr_data* data) {
+    size_t size = 0;
+    for(u32 i = 0; i < data->partCount; i++) {
+        size += strlen(data->parts[i]);
+    }
+
+    if(size >= DOWNLOAD_URL_MAX * INSTALL_URLS_MAX) {
+        return false;
+    }
+
+    char* payload = (char*) calloc(size + 1, sizeof(char));
+    if(payload == NULL) {
+        return false;
+    }
+
+    size_t pos = 0;
+    for(u32 i = 0; i < data->partCount; i++) {
+        size_t len = strlen(data->parts[i]);
+        memcpy(payload + pos, data->parts[i], len);
+        pos += len;
+    }
+
+    if(data->partParity >= 0) {
+        u8 parity = 0;
+        for(size_t i = 0; i < size; i++) {
+            parity ^= (u8) payload[i];
+        }
+
+        if(parity != data->partParity) {
+            free(payload);
+            return false;
+        }
+    }
+
+    data->payload = payload;
+    return true;
+}
+
+// Adds a decoded code to the payload being assembled, returning true once the payload is complete.
+static bool remoteinstall_qr_add_part(remoteinstall_qr_data* data, const struct quirc_data* qrData) {
+    const char* text = (const char*) qrData->payload;
+
+    char id[QR_PART_ID_MAX] = "";
+    int parity = -1;
+    unsigned long index = 0;
+    unsigned long count = 0;
+
+    if(qrData->sa_size > 0) {
+        parity = qrData->sa_parity;
+        index = (unsigned long) qrData->sa_index;
+        count = (unsigned long) qrData->sa_size;
+    } else if(strncmp(text, QR_PART_PREFIX, strlen(QR_PART_PREFIX)) == 0) {
+        const char* idStart = text + strlen(QR_PART_PREFIX);
+        const char* idEnd = strchr(idStart, ':');
+        if(idEnd == NULL || idEnd - idStart >= QR_PART_ID_MAX) {
+            return false;
+        }
+
+        string_copy(id, idStart, (size_t) (idEnd - idStart + 1));
+
+        char* end = NULL;
+        index = strtoul(idEnd + 1, &end, 10);
+        if(*end != '/') {
+            return false;
+        }
+
+        count = strtoul(end + 1, &end, 10);
+        if(*end != ':') {
+            return false;
+        }
+
+        text = end + 1;
+    } else {
+        data->payload = strdup(text);
+        return data->payload != NULL;
+    }
+
+    if(index < 1 || index > count || count > QR_PARTS_MAX) {
+        return false;
+    }
+
+    // A part from a different set starts over.
+    if(count != data->partCount || parity != data->partParity || strcmp(id, data->partId) != 0) {
+        remoteinstall_qr_reset_parts(data);
+
+        string_copy(data->partId, id, sizeof(data->partId));
+        data->partParity = parity;
+        data->partCount = (u32) count;
+    }
+
+    if(data->parts[index - 1] != NULL || (data->parts[index - 1] = strdup(text)) == NULL) {
+        return false;
+    }
+
+    if(++data->partsScanned < data->partCount) {
+        return false;
+    }
+
+    bool joined = remoteinstall_qr_join_parts(data);
+    remoteinstall_qr_reset_parts(data);
+
+    return joined;
+}
+
+static void remoteinstall_qr_decode(remoteinstall_qr_data* data, struct quirc* q) {
+    quirc_end(q);
+
+    int qrCount = quirc_count(q);
+    for(int i = 0; i < qrCount; i++) {
+        struct quirc_code qrCode;
+        quirc_extract(q, i, &qrCode);
+
+        struct quirc_data qrData;
+        if(quirc_decode(&qrCode, &qrData) == 0 && remoteinstall_qr_add_part(data, &qrData)) {
+            data->decoded = true;
+            break;
+        }
+    }
+}
+
+// Derives the region searched on the next frames from the capstones found in the last scan.
+static void remoteinstall_qr_track(remoteinstall_qr_data* data, struct quirc* q, int offsetX, int offsetY, int scale) {
+    data->roiValid = false;
+
+    if(q->num_capstones < QR_ROI_MIN_CAPSTONES) {
+        return;
+    }
+
+    int minX = q->w;
+    int minY = q->h;
+    int maxX = 0;
+    int maxY = 0;
+    for(int i = 0; i < q->num_capstones; i++) {
+        for(int j = 0; j < 4; j++) {
+            struct quirc_point* point = &q->capstones[i].corners[j];
+
+            minX = point->x < minX ? point->x : minX;
+            minY = point->y < minY ? point->y : minY;
+            maxX = point->x > maxX ? point->x : maxX;
+            maxY = point->y > maxY ? point->y : maxY;
+        }
+    }
+
+    if(maxX < minX || maxY < minY) {
+        return;
+    }
+
+    minX *= scale;
+    minY *= scale;
+    maxX = (maxX + 1) * scale - 1;
+    maxY = (maxY + 1) * scale - 1;
+
+    int pad = ((maxX - minX > maxY - minY ? maxX - minX : maxY - minY) / 4) + QR_ROI_ALIGN;
+
+    minX = (minX + offsetX - pad) & ~(QR_ROI_ALIGN - 1);
+    minY = (minY + offsetY - pad) & ~(QR_ROI_ALIGN - 1);
+    maxX = (maxX + offsetX + pad + QR_ROI_ALIGN - 1) & ~(QR_ROI_ALIGN - 1);
+    maxY = (maxY + offsetY + pad + QR_ROI_ALIGN - 1) & ~(QR_ROI_ALIGN - 1);
+
+    minX = minX < 0 ? 0 : minX;
+    minY = minY < 0 ? 0 : minY;
+    maxX = maxX > QR_IMAGE_WIDTH ? QR_IMAGE_WIDTH : maxX;
+    maxY = maxY > QR_IMAGE_HEIGHT ? QR_IMAGE_HEIGHT : maxY;
+
+    // Not worth tracking a region covering most of the frame.
+    if((maxX - minX) * (maxY - minY) > QR_IMAGE_WIDTH * QR_IMAGE_HEIGHT / 2) {
+        return;
+    }
+
+    data->roiX = minX;
+    data->roiY = minY;
+    data->roiW = maxX - minX;
+    data->roiH = maxY - minY;
+    data->roiValid = true;
+}
+
+static bool remoteinstall_qr_prepare_roi(remoteinstall_qr_data* data) {
+    if((data->roiContext->w != data->roiW || data->roiContext->h != data->roiH) && quirc_resize(data->roiContext, data->roiW, data->roiH) != 0) {
+        data->roiValid = false;
+    }
+
+    return data->roiValid;
+}
+
+// Box-filters the luma image down by QR_COARSE_SCALE in each direction.
+static void remoteinstall_qr_downsample(u8* dst, const u8* src) {
+    for(u32 y = 0; y < QR_COARSE_HEIGHT; y++) {
+        const u8* top = src + y * QR_COARSE_SCALE * QR_IMAGE_WIDTH;
+        const u8* bottom = top + QR_IMAGE_WIDTH;
+
+        for(u32 x = 0; x < QR_COARSE_WIDTH; x++) {
+            *dst++ = (u8) ((top[0] + top[1] + bottom[0] + bottom[1] + 2) >> 2);
+
+            top += QR_COARSE_SCALE;
+            bottom += QR_COARSE_SCALE;
+        }
+    }
+}
+
+// Looks for codes at half resolution first. Close codes decode there directly, otherwise the
+// capstones found are refined at full resolution inside their region. Small, distant codes only
+// show up at full resolution, so every QR_COARSE_MISS_INTERVAL misses fall back to a full scan.
+static void remoteinstall_qr_scan_coarse(remoteinstall_qr_data* data, const u8* luma) {
+    remoteinstall_qr_downsample(quirc_begin(data->coarseContext, NULL, NULL), luma);
+
+    remoteinstall_qr_decode(data, data->coarseContext);
+    if(data->decoded) {
+        return;
+    }
+
+    remoteinstall_qr_track(data, data->coarseContext, 0, 0, QR_COARSE_SCALE);
+
+    if(remoteinstall_qr_prepare_roi(data)) {
+        int x = data->roiX;
+        int y = data->roiY;
+
+        u8* roiBuf = quirc_begin(data->roiContext, NULL, NULL);
+        for(int row = 0; row < data->roiH; row++) {
+            memcpy(roiBuf + row * data->roiW, luma + (y + row) * QR_IMAGE_WIDTH + x, (size_t) data->roiW);
+        }
+
+        data->coarseMisses = 0;
+        data->roiScans = 1;
+
+        remoteinstall_qr_decode(data, data->roiContext);
+        remoteinstall_qr_track(data, data->roiContext, x, y, 1);
+        return;
+    }
+
+    if(++data->coarseMisses >= QR_COARSE_MISS_INTERVAL) {
+        data->coarseMisses = 0;
+
+        remoteinstall_qr_decode(data, data->qrContext);
+        remoteinstall_qr_track(data, data->qrContext, 0, 0, 1);
+    }
+}
+
+#ifdef DEBUG_STATS
+static void remoteinstall_qr_update_stats(remoteinstall_qr_data* data, u64 start) {
+    u64 now = svcGetSystemTick();
+    data->statsBusy += now - start;
+
+    u64 elapsed = now - data->statsStart;
+    if(elapsed >= SYSCLOCK_ARM11) {
+        data->latencyMs = data->statsScans > 0 ? (u32) (data->statsLatency * 1000 / data->statsScans / SYSCLOCK_ARM11) : 0;
+        data->cpuPercent = (u32) (data->statsBusy * 100 / elapsed);
+
+        data->statsStart = now;
+        data->statsBusy = 0;
+        data->statsLatency = 0;
+        data->statsScans = 0;
+    }
+}
+#endif
+
+static void remoteinstall_qr_decode_thread(void* arg) {
+    remoteinstall_qr_data* data = (remoteinstall_qr_data*) arg;
+
+#ifdef DEBUG_STATS
+    data->statsStart = svcGetSystemTick();
+#endif
+
+    s32 index = 0;
+    while(R_SUCCEEDED(svcWaitSynchronizationN(&index, data->decodeEvents, QR_DECODE_EVENT_COUNT, false, U64_MAX)) && index != QR_DECODE_EVENT_QUIT) {
+#ifdef DEBUG_STATS
+        u64 start = svcGetSystemTick();
+#endif
+
+        if(data->decoded) {
+            continue;
+        }
+
+        // Search around the last known code, with a periodic coarse-to-fine scan to pick up new ones.
+        bool roi = data->roiValid && data->roiScans < QR_FULL_SCAN_INTERVAL && remoteinstall_qr_prepare_roi(data);
+
+        struct quirc* q = roi ? data->roiContext : data->qrContext;
+        int x = roi ? data->roiX : 0;
+        int y = roi ? data->roiY : 0;
+
+        uint8_t* qrBuf = quirc_begin(q, NULL, NULL);
+
+        svcWaitSynchronization(data->decodeMutex, U64_MAX);
+
+        bool captured = data->capturing && !data->captureInfo.finished;
+        bool changed = false;
+        if(captured) {
+            svcWaitSynchronization(data->captureInfo.mutex, U64_MAX);
+
+            if((changed = remoteinstall_qr_frame_changed(data, data->captureInfo.buffer))) {
+                remoteinstall_qr_convert(qrBuf, data->captureInfo.buffer, x, y, q->w, q->h);
+            }
+
+            svcReleaseMutex(data->captureInfo.mutex);
+        }
+
+        svcReleaseMutex(data->decodeMutex);
+
+        if(!captured) {
+            data->roiValid = false;
+            data->thumbValid = false;
+            continue;
+        }
+
+        // The preview only changes when a frame arrives.
+        ui_invalidate();
+
+        if(changed) {
+            if(roi) {
+                data->roiScans++;
+
+                remoteinstall_qr_decode(data, q);
+                remoteinstall_qr_track(data, q, x, y, 1);
+            } else {
+                data->roiScans = 0;
+
+                remoteinstall_qr_scan_coarse(data, qrBuf);
+            }
+
+#ifdef DEBUG_STATS
+            data->statsLatency += svcGetSystemTick() - start;
+            data->statsScans++;
+#endif
+        }
+
+#ifdef DEBUG_STATS
+        remoteinstall_qr_update_stats(data, start);
+#endif
+    }
+}
+
 static void remoteinstall_qr_stop_capture(remoteinstall_qr_data* data) {
+    if(data->decodeMutex != 0) {
+        svcWaitSynchronization(data->decodeMutex, U64_MAX);
+    }
+
     if(!data->captureInfo.finished) {
         svcSignalEvent(data->captureInfo.cancelEvent);
         while(!data->captureInfo.finished) {
@@ -263,11 +740,42 @@ static void remoteinstall_qr_stop_capture(remoteinstall_qr_data* data) {
     if(data->captureInfo.buffer != NULL) {
         memset(data->captureInfo.buffer, 0, QR_IMAGE_WIDTH * QR_IMAGE_HEIGHT * sizeof(u16));
     }
+
+    if(data->decodeMutex != 0) {
+        svcReleaseMutex(data->decodeMutex);
+    }
 }
 
 static void remoteinstall_qr_free_data(remoteinstall_qr_data* data) {
     remoteinstall_qr_stop_capture(data);
 
+    if(data->decodeThread != NULL) {
+        svcSignalEvent(data->decodeEvents[QR_DECODE_EVENT_QUIT]);
+
+        threadJoin(data->decodeThread, U64_MAX);
+        threadFree(data->decodeThread);
+        data->decodeThread = NULL;
+    }
+
+    for(int i = 0; i < QR_DECODE_EVENT_COUNT; i++) {
+        if(data->decodeEvents[i] != 0) {
+            svcCloseHandle(data->decodeEvents[i]);
+            data->decodeEvents[i] = 0;
+        }
+    }
+
+    if(data->decodeMutex != 0) {
+        svcCloseHandle(data->decodeMutex);
+        data->decodeMutex = 0;
+    }
+
+    remoteinstall_qr_reset_parts(data);
+
+    if(data->payload != NULL) {
+        free(data->payload);
+        data->payload = NULL;
+    }
+
     if(data->captureInfo.buffer != NULL) {
         free(data->captureInfo.buffer);
         data->captureInfo.buffer = NULL;
@@ -283,6 +791,16 @@ static void remoteinstall_qr_free_data(remoteinstall_qr_data* data) {
         data->qrContext = NULL;
     }
 
+    if(data->roiContext != NULL) {
+        quirc_destroy(data->roiContext);
+        data->roiContext = NULL;
+    }
+
+    if(data->coarseContext != NULL) {
+        quirc_destroy(data->coarseContext);
+        data->coarseContext = NULL;
+    }
+
     free(data);
 }
 
@@ -318,6 +836,21 @@ static void remoteinstall_qr_update(ui_view* view, void* data, float* progress,
         return;
     }
 
+    if(installData->decoded) {
+        remoteinstall_qr_stop_capture(installData);
+
+        char* payload = installData->payload;
+        installData->payload = NULL;
+        installData->decoded = false;
+
+        remoteinstall_set_last_urls(payload);
+
+        action_install_url("Install from the scanned QR code?", payload, NULL, NULL, NULL, NULL, NULL);
+
+        free(payload);
+        return;
+    }
+
     if(!installData->capturing) {
         Result capRes = task_capture_cam(&installData->captureInfo);
         if(R_FAILED(capRes)) {
@@ -346,42 +879,17 @@ static void remoteinstall_qr_update(ui_view* view, void* data, float* progress,
         return;
     }
 
-    int w = 0;
-    int h = 0;
-    uint8_t* qrBuf = quirc_begin(installData->qrContext, &w, &h);
-
-    svcWaitSynchronization(installData->captureInfo.mutex, U64_MAX);
-
-    for(int x = 0; x < w; x++) {
-        for(int y = 0; y < h; y++) {
-            u16 px = installData->captureInfo.buffer[y * QR_IMAGE_WIDTH + x];
-            qrBuf[y * w + x] = (u8) (((((px >> 11) & 0x1F) << 3) + (((px >> 5) & 0x3F) << 2) + ((px & 0x1F) << 3)) / 3);
-        }
-    }
-
-    svcReleaseMutex(installData->captureInfo.mutex);
-
-    quirc_end(installData->qrContext);
-
-    int qrCount = quirc_count(installData->qrContext);
-    for(int i = 0; i < qrCount; i++) {
-        struct quirc_code qrCode;
-        quirc_extract(installData->qrContext, i, &qrCode);
-
-        struct quirc_data qrData;
-        quirc_decode_error_t err = quirc_decode(&qrCode, &qrData);
-
-        if(err == 0) {
-            remoteinstall_qr_stop_capture(installData);
-
-            remoteinstall_set_last_urls((const char*) qrData.payload);
-
-            action_install_url("Install from the scanned QR code?", (const char*) qrData.payload, NULL, NULL, NULL, NULL, NULL);
-            return;
-        }
+    u32 partCount = installData->partCount;
+    if(partCount > 0) {
+        snprintf(text, PROGRESS_TEXT_MAX, "Scanned %lu of %lu QR codes...", installData->partsScanned, partCount);
+    } else {
+        snprintf(text, PROGRESS_TEXT_MAX, "Waiting for QR code...");
     }
 
-    snprintf(text, PROGRESS_TEXT_MAX, "Waiting for QR code...");
+#ifdef DEBUG_STATS
+    size_t len = strlen(text);
+    snprintf(text + len, PROGRESS_TEXT_MAX - len, "\nDecode: %lu ms, CPU: %lu%%", installData->latencyMs, installData->cpuPercent);
+#endif
 }
 
 static void remoteinstall_scan_qr_code() {
@@ -403,15 +911,19 @@ static void remoteinstall_scan_qr_code() {
 
     data->captureInfo.finished = true;
 
+    data->partParity = -1;
+
     data->qrContext = quirc_new();
-    if(data->qrContext == NULL) {
+    data->roiContext = quirc_new();
+    data->coarseContext = quirc_new();
+    if(data->qrContext == NULL || data->roiContext == NULL || data->coarseContext == NULL) {
         error_display(NULL, NULL, "Failed to create QR context.");
 
         remoteinstall_qr_free_data(data);
         return;
     }
 
-    if(quirc_resize(data->qrContext, QR_IMAGE_WIDTH, QR_IMAGE_HEIGHT) != 0) {
+    if(quirc_resize(data->qrContext, QR_IMAGE_WIDTH, QR_IMAGE_HEIGHT) != 0 || quirc_resize(data->coarseContext, QR_COARSE_WIDTH, QR_COARSE_HEIGHT) != 0) {
         error_display(NULL, NULL, "Failed to resize QR context.");
 
         remoteinstall_qr_free_data(data);
@@ -426,6 +938,25 @@ static void remoteinstall_scan_qr_code() {
         return;
     }
 
+    Result res = 0;
+    if(R_FAILED(res = svcCreateMutex(&data->decodeMutex, false))
+       || R_FAILED(res = svcCreateEvent(&data->decodeEvents[QR_DECODE_EVENT_QUIT], RESET_STICKY))
+       || R_FAILED(res = svcCreateEvent(&data->decodeEvents[QR_DECODE_EVENT_FRAME], RESET_ONESHOT))) {
+        error_display_res(NULL, NULL, res, "Failed to create QR decode events.");
+
+        remoteinstall_qr_free_data(data);
+        return;
+    }
+
+    data->captureInfo.frameEvent = data->decodeEvents[QR_DECODE_EVENT_FRAME];
+
+    if((data->decodeThread = threadCreate(remoteinstall_qr_decode_thread, data, 0x10000, 0x31, 0, false)) == NULL) {
+        error_display(NULL, NULL, "Failed to create QR decode thread.");
+
+        remoteinstall_qr_free_data(data);
+        return;
+    }
+
     data->tex = screen_allocate_free_texture();
 
     info_display("QR Code Install", "B: Return, X: Switch Camera", false, data, remoteinstall_qr_update, remoteinstall_qr_draw_top);
@@ -473,7 +1004,7 @@ static list_item manually_enter_urls = {"Manually enter URLs", COLOR_TEXT, remot
 static list_item repeat_last_request = {"Repeat last request", COLOR_TEXT, remoteinstall_repeat_last_request};
 static list_item forget_last_request = {"Forget last request", COLOR_TEXT, remoteinstall_forget_last_request};
 
-static void remoteinstall_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void remoteinstall_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     if(hidKeysDown() & KEY_B) {
         ui_pop();
         list_destroy(view);
@@ -486,12 +1017,12 @@ static void remoteinstall_update(ui_view* view, void* data, linked_list* items,
         return;
     }
 
-    if(linked_list_size(items) == 0) {
-        linked_list_add(items, &receive_urls_network);
-        linked_list_add(items, &scan_qr_code);
-        linked_list_add(items, &manually_enter_urls);
-        linked_list_add(items, &repeat_last_request);
-        linked_list_add(items, &forget_last_request);
+    if(array_list_size(items) == 0) {
+        array_list_add(items, &receive_urls_network);
+        array_list_add(items, &scan_qr_code);
+        array_list_add(items, &manually_enter_urls);
+        array_list_add(items, &repeat_last_request);
+        array_list_add(items, &forget_last_request);
     }
 }
 
@@ -1,5 +1,7 @@
+#include <dirent.h>
 #include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <3ds.h>
@@ -22,6 +24,296 @@ static FILE* resources_open_file(const char* path) {
     }
 }
 
+#define THEME_BUNDLE_PATH "/fbi/cache/theme.bin"
+#define THEME_BUNDLE_MAGIC 0x48544246 // "FBTH"
+#define THEME_BUNDLE_VERSION 2
+
+typedef struct {
+    u32 id;
+    const char* key;
+} resources_color;
+
+typedef struct {
+    u32 id;
+    const char* name;
+} resources_texture;
+
+static const resources_color colors[] = {
+    {COLOR_TEXT, "text"},
+    {COLOR_NAND, "nand"},
+    {COLOR_SD, "sd"},
+    {COLOR_GAME_CARD, "gamecard"},
+    {COLOR_DS_TITLE, "dstitle"},
+    {COLOR_FILE, "file"},
+    {COLOR_DIRECTORY, "directory"},
+    {COLOR_ENABLED, "enabled"},
+    {COLOR_DISABLED, "disabled"},
+    {COLOR_TICKET_IN_USE, "ticketinuse"},
+    {COLOR_TICKET_NOT_IN_USE, "ticketnotinuse"}
+};
+
+static const resources_texture textures[] = {
+    {TEXTURE_BOTTOM_SCREEN_BG, "bottom_screen_bg.png"},
+    {TEXTURE_BOTTOM_SCREEN_TOP_BAR, "bottom_screen_top_bar.png"},
+    {TEXTURE_BOTTOM_SCREEN_TOP_BAR_SHADOW, "bottom_screen_top_bar_shadow.png"},
+    {TEXTURE_BOTTOM_SCREEN_BOTTOM_BAR, "bottom_screen_bottom_bar.png"},
+    {TEXTURE_BOTTOM_SCREEN_BOTTOM_BAR_SHADOW, "bottom_screen_bottom_bar_shadow.png"},
+    {TEXTURE_TOP_SCREEN_BG, "top_screen_bg.png"},
+    {TEXTURE_TOP_SCREEN_TOP_BAR, "top_screen_top_bar.png"},
+    {TEXTURE_TOP_SCREEN_TOP_BAR_SHADOW, "top_screen_top_bar_shadow.png"},
+    {TEXTURE_TOP_SCREEN_BOTTOM_BAR, "top_screen_bottom_bar.png"},
+    {TEXTURE_TOP_SCREEN_BOTTOM_BAR_SHADOW, "top_screen_bottom_bar_shadow.png"},
+    {TEXTURE_LOGO, "logo.png"},
+    {TEXTURE_SELECTION_OVERLAY, "selection_overlay.png"},
+    {TEXTURE_SCROLL_BAR, "scroll_bar.png"},
+    {TEXTURE_BUTTON, "button.png"},
+    {TEXTURE_PROGRESS_BAR_BG, "progress_bar_bg.png"},
+    {TEXTURE_PROGRESS_BAR_CONTENT, "progress_bar_content.png"},
+    {TEXTURE_META_INFO_BOX, "meta_info_box.png"},
+    {TEXTURE_META_INFO_BOX_SHADOW, "meta_info_box_shadow.png"},
+    {TEXTURE_BATTERY_CHARGING, "battery_charging.png"},
+    {TEXTURE_BATTERY_0, "battery0.png"},
+    {TEXTURE_BATTERY_1, "battery1.png"},
+    {TEXTURE_BATTERY_2, "battery2.png"},
+    {TEXTURE_BATTERY_3, "battery3.png"},
+    {TEXTURE_BATTERY_4, "battery4.png"},
+    {TEXTURE_BATTERY_5, "battery5.png"},
+    {TEXTURE_WIFI_DISCONNECTED, "wifi_disconnected.png"},
+    {TEXTURE_WIFI_0, "wifi0.png"},
+    {TEXTURE_WIFI_1, "wifi1.png"},
+    {TEXTURE_WIFI_2, "wifi2.png"},
+    {TEXTURE_WIFI_3, "wifi3.png"}
+};
+
+#define COLOR_COUNT (sizeof(colors) / sizeof(colors[0]))
+#define TEXTURE_COUNT (sizeof(textures) / sizeof(textures[0]))
+
+// The theme bundle caches the parsed color table and GPU-ready tiled copies of the textures
+// overridden on the SD card, so a warm start reads those instead of decoding their PNGs.
+// Romfs textures are left out, as their PNGs are a small fraction of the size of their tiles.
+typedef struct {
+    u32 magic;
+    u32 version;
+    u64 stamp;
+    u32 colorCount;
+    u32 colorMask;
+    u32 textureCount;
+} theme_bundle_header;
+
+typedef struct {
+    u32 id;
+    u32 width;
+    u32 height;
+    u32 format;
+    u32 size;
+} theme_bundle_texture;
+
+// Colors missing from textcolor.cfg keep the screen defaults, so the mask tracks which were set.
+static u32 colorValues[COLOR_COUNT];
+static u32 colorMask = 0;
+
+// Which theme files are overridden on the SD card, indexed like textures with textcolor.cfg last.
+static bool overridden[TEXTURE_COUNT + 1];
+static u32 overriddenTextureCount = 0;
+
+static u64 resources_hash(u64 hash, const void* data, size_t size) {
+    for(size_t i = 0; i < size; i++) {
+        hash ^= ((const u8*) data)[i];
+        hash *= 0x100000001B3;
+    }
+
+    return hash;
+}
+
+static const char* resources_get_name(u32 index) {
+    return index < TEXTURE_COUNT ? textures[index].name : "textcolor.cfg";
+}
+
+// Identifies the theme sources: the app version, the romfs contents as hashed at build time,
+// and which files are overridden on the SD card along with their modification times. The SD
+// theme directory is listed once, so files that are not overridden cost no lookups.
+static u64 resources_get_stamp() {
+    u64 hash = 0xCBF29CE484222325;
+
+    u32 version[3] = {VERSION_MAJOR, VERSION_MINOR, VERSION_MICRO};
+    hash = resources_hash(hash, version, sizeof(version));
+
+    u32 romfsHash = ROMFS_HASH;
+    hash = resources_hash(hash, &romfsHash, sizeof(romfsHash));
+
+    memset(overridden, 0, sizeof(overridden));
+    overriddenTextureCount = 0;
+
+    DIR* dir = opendir("sdmc:/fbi/theme/");
+    if(dir != NULL) {
+        struct dirent* entry = NULL;
+        while((entry = readdir(dir)) != NULL) {
+            for(u32 i = 0; i <= TEXTURE_COUNT; i++) {
+                if(strcasecmp(entry->d_name, resources_get_name(i)) == 0) {
+                    overridden[i] = true;
+                    break;
+                }
+            }
+        }
+
+        closedir(dir);
+    }
+
+    char path[FILE_PATH_MAX];
+    for(u32 i = 0; i <= TEXTURE_COUNT; i++) {
+        if(!overridden[i]) {
+            continue;
+        }
+
+        if(i < TEXTURE_COUNT) {
+            overriddenTextureCount++;
+        }
+
+        const char* name = resources_get_name(i);
+        snprintf(path, sizeof(path), "sdmc:/fbi/theme/%s", name);
+
+        u64 mtime = 0;
+        sdmc_getmtime(path, &mtime);
+
+        hash = resources_hash(hash, name, strlen(name));
+        hash = resources_hash(hash, &mtime, sizeof(mtime));
+    }
+
+    return hash;
+}
+
+static bool resources_load_bundle(u64 stamp) {
+    bool loaded = false;
+
+    FS_Archive sdmcArchive = 0;
+    if(R_SUCCEEDED(FSUSER_OpenArchive(&sdmcArchive, ARCHIVE_SDMC, fsMakePath(PATH_EMPTY, "")))) {
+        Handle fileHandle = 0;
+        if(R_SUCCEEDED(FSUSER_OpenFile(&fileHandle, sdmcArchive, fsMakePath(PATH_ASCII, THEME_BUNDLE_PATH), FS_OPEN_READ, 0))) {
+            u64 size = 0;
+            u8* bundle = NULL;
+            u32 bytesRead = 0;
+
+            if(R_SUCCEEDED(FSFILE_GetSize(fileHandle, &size)) && size >= sizeof(theme_bundle_header) && (u32) size == size
+               && (bundle = (u8*) malloc((size_t) size)) != NULL
+               && R_SUCCEEDED(FSFILE_Read(fileHandle, &bytesRead, 0, bundle, (u32) size)) && bytesRead == size) {
+                theme_bundle_header* header = (theme_bundle_header*) bundle;
+                u32 tableSize = sizeof(theme_bundle_header) + header->colorCount * sizeof(u32) + header->textureCount * sizeof(theme_bundle_texture);
+
+                if(header->magic == THEME_BUNDLE_MAGIC && header->version == THEME_BUNDLE_VERSION && header->stamp == stamp
+                   && header->colorCount == COLOR_COUNT && header->textureCount == overriddenTextureCount && tableSize <= size) {
+                    u32* bundleColors = (u32*) &bundle[sizeof(theme_bundle_header)];
+                    theme_bundle_texture* bundleTextures = (theme_bundle_texture*) &bundleColors[COLOR_COUNT];
+
+                    // Validate the whole table before touching any state.
+                    u64 dataSize = 0;
+                    bool valid = true;
+                    for(u32 i = 0, j = 0; i < TEXTURE_COUNT && valid; i++) {
+                        if(!overridden[i]) {
+                            continue;
+                        }
+
+                        theme_bundle_texture* texture = &bundleTextures[j++];
+                        valid = texture->id == textures[i].id && texture->width > 0 && texture->height > 0
+                                && texture->size == ((texture->width + 7) & ~7) * ((texture->height + 7) & ~7) * 4;
+                        dataSize += texture->size;
+                    }
+
+                    if(valid && tableSize + dataSize == size) {
+                        for(u32 i = 0; i < COLOR_COUNT; i++) {
+                            if(header->colorMask & (1 << i)) {
+                                screen_set_color(colors[i].id, bundleColors[i]);
+                            }
+                        }
+
+                        u8* data = &bundle[tableSize];
+                        for(u32 i = 0; i < overriddenTextureCount; i++) {
+                            theme_bundle_texture* texture = &bundleTextures[i];
+                            screen_load_texture_tiled(texture->id, data, texture->size, texture->width, texture->height, (GPU_TEXCOLOR) texture->format, true);
+                            data += texture->size;
+                        }
+
+                        loaded = true;
+                    }
+                }
+            }
+
+            free(bundle);
+
+            FSFILE_Close(fileHandle);
+        }
+
+        FSUSER_CloseArchive(sdmcArchive);
+    }
+
+    return loaded;
+}
+
+static void resources_save_bundle(u64 stamp) {
+    u32 tableSize = sizeof(theme_bundle_header) + COLOR_COUNT * sizeof(u32) + overriddenTextureCount * sizeof(theme_bundle_texture);
+    u32 size = tableSize;
+
+    theme_bundle_texture bundleTextures[TEXTURE_COUNT];
+    for(u32 i = 0, j = 0; i < TEXTURE_COUNT; i++) {
+        if(!overridden[i]) {
+            continue;
+        }
+
+        theme_bundle_texture* texture = &bundleTextures[j++];
+        texture->id = textures[i].id;
+        texture->format = GPU_RGBA8;
+
+        screen_get_texture_size(&texture->width, &texture->height, texture->id);
+        texture->size = ((texture->width + 7) & ~7) * ((texture->height + 7) & ~7) * 4;
+
+        size += texture->size;
+    }
+
+    u8* bundle = (u8*) malloc(size);
+    if(bundle == NULL) {
+        return;
+    }
+
+    theme_bundle_header* header = (theme_bundle_header*) bundle;
+    header->magic = THEME_BUNDLE_MAGIC;
+    header->version = THEME_BUNDLE_VERSION;
+    header->stamp = stamp;
+    header->colorCount = COLOR_COUNT;
+    header->colorMask = colorMask;
+    header->textureCount = overriddenTextureCount;
+
+    memcpy(&bundle[sizeof(theme_bundle_header)], colorValues, sizeof(colorValues));
+    memcpy(&bundle[sizeof(theme_bundle_header) + sizeof(colorValues)], bundleTextures, overriddenTextureCount * sizeof(theme_bundle_texture));
+
+    bool valid = true;
+    u8* data = &bundle[tableSize];
+    for(u32 i = 0; i < overriddenTextureCount && valid; i++) {
+        valid = screen_get_texture_tiled(bundleTextures[i].id, data, bundleTextures[i].size);
+        data += bundleTextures[i].size;
+    }
+
+    FS_Archive sdmcArchive = 0;
+    if(valid && R_SUCCEEDED(FSUSER_OpenArchive(&sdmcArchive, ARCHIVE_SDMC, fsMakePath(PATH_EMPTY, "")))) {
+        if(R_SUCCEEDED(fs_ensure_dir(sdmcArchive, "/fbi/")) && R_SUCCEEDED(fs_ensure_dir(sdmcArchive, "/fbi/cache/"))) {
+            Handle fileHandle = 0;
+            if(R_SUCCEEDED(FSUSER_OpenFile(&fileHandle, sdmcArchive, fsMakePath(PATH_ASCII, THEME_BUNDLE_PATH), FS_OPEN_WRITE | FS_OPEN_CREATE, 0))) {
+                u32 bytesWritten = 0;
+                if(R_FAILED(FSFILE_SetSize(fileHandle, size))
+                   || R_FAILED(FSFILE_Write(fileHandle, &bytesWritten, 0, bundle, size, FS_WRITE_FLUSH | FS_WRITE_UPDATE_TIME))
+                   || bytesWritten != size) {
+                    // Leave nothing that could pass for a valid bundle.
+                    FSFILE_SetSize(fileHandle, 0);
+                }
+
+                FSFILE_Close(fileHandle);
+            }
+        }
+
+        FSUSER_CloseArchive(sdmcArchive);
+    }
+
+    free(bundle);
+}
+
 static void resources_load_texture(u32 id, const char* name) {
     FILE* fd = resources_open_file(name);
     if(fd == NULL) {
@@ -34,7 +326,7 @@ static void resources_load_texture(u32 id, const char* name) {
     fclose(fd);
 }
 
-void resources_load() {
+static void resources_load_colors() {
     FILE* fd = resources_open_file("textcolor.cfg");
     if(fd == NULL) {
         error_panic("Failed to open text color config: %s\n", strerror(errno));
@@ -48,61 +340,34 @@ void resources_load() {
 
         sscanf(line, "%63[^=]=%lx", key, &color);
 
-        if(strcasecmp(key, "text") == 0) {
-            screen_set_color(COLOR_TEXT, color);
-        } else if(strcasecmp(key, "nand") == 0) {
-            screen_set_color(COLOR_NAND, color);
-        } else if(strcasecmp(key, "sd") == 0) {
-            screen_set_color(COLOR_SD, color);
-        } else if(strcasecmp(key, "gamecard") == 0) {
-            screen_set_color(COLOR_GAME_CARD, color);
-        } else if(strcasecmp(key, "dstitle") == 0) {
-            screen_set_color(COLOR_DS_TITLE, color);
-        } else if(strcasecmp(key, "file") == 0) {
-            screen_set_color(COLOR_FILE, color);
-        } else if(strcasecmp(key, "directory") == 0) {
-            screen_set_color(COLOR_DIRECTORY, color);
-        } else if(strcasecmp(key, "enabled") == 0) {
-            screen_set_color(COLOR_ENABLED, color);
-        } else if(strcasecmp(key, "disabled") == 0) {
-            screen_set_color(COLOR_DISABLED, color);
-        } else if(strcasecmp(key, "ticketinuse") == 0) {
-            screen_set_color(COLOR_TICKET_IN_USE, color);
-        } else if(strcasecmp(key, "ticketnotinuse") == 0) {
-            screen_set_color(COLOR_TICKET_NOT_IN_USE, color);
+        for(u32 i = 0; i < COLOR_COUNT; i++) {
+            if(strcasecmp(key, colors[i].key) == 0) {
+                colorValues[i] = color;
+                colorMask |= 1 << i;
+                screen_set_color(colors[i].id, color);
+                break;
+            }
         }
     }
 
     fclose(fd);
+}
+
+void resources_load() {
+    u64 stamp = resources_get_stamp();
+
+    bool bundled = overriddenTextureCount > 0 && resources_load_bundle(stamp);
+    if(!bundled) {
+        resources_load_colors();
+    }
 
-    resources_load_texture(TEXTURE_BOTTOM_SCREEN_BG, "bottom_screen_bg.png");
-    resources_load_texture(TEXTURE_BOTTOM_SCREEN_TOP_BAR, "bottom_screen_top_bar.png");
-    resources_load_texture(TEXTURE_BOTTOM_SCREEN_TOP_BAR_SHADOW, "bottom_screen_top_bar_shadow.png");
-    resources_load_texture(TEXTURE_BOTTOM_SCREEN_BOTTOM_BAR, "bottom_screen_bottom_bar.png");
-    resources_load_texture(TEXTURE_BOTTOM_SCREEN_BOTTOM_BAR_SHADOW, "bottom_screen_bottom_bar_shadow.png");
-    resources_load_texture(TEXTURE_TOP_SCREEN_BG, "top_screen_bg.png");
-    resources_load_texture(TEXTURE_TOP_SCREEN_TOP_BAR, "top_screen_top_bar.png");
-    resources_load_texture(TEXTURE_TOP_SCREEN_TOP_BAR_SHADOW, "top_screen_top_bar_shadow.png");
-    resources_load_texture(TEXTURE_TOP_SCREEN_BOTTOM_BAR, "top_screen_bottom_bar.png");
-    resources_load_texture(TEXTURE_TOP_SCREEN_BOTTOM_BAR_SHADOW, "top_screen_bottom_bar_shadow.png");
-    resources_load_texture(TEXTURE_LOGO, "logo.png");
-    resources_load_texture(TEXTURE_SELECTION_OVERLAY, "selection_overlay.png");
-    resources_load_texture(TEXTURE_SCROLL_BAR, "scroll_bar.png");
-    resources_load_texture(TEXTURE_BUTTON, "button.png");
-    resources_load_texture(TEXTURE_PROGRESS_BAR_BG, "progress_bar_bg.png");
-    resources_load_texture(TEXTURE_PROGRESS_BAR_CONTENT, "progress_bar_content.png");
-    resources_load_texture(TEXTURE_META_INFO_BOX, "meta_info_box.png");
-    resources_load_texture(TEXTURE_META_INFO_BOX_SHADOW, "meta_info_box_shadow.png");
-    resources_load_texture(TEXTURE_BATTERY_CHARGING, "battery_charging.png");
-    resources_load_texture(TEXTURE_BATTERY_0, "battery0.png");
-    resources_load_texture(TEXTURE_BATTERY_1, "battery1.png");
-    resources_load_texture(TEXTURE_BATTERY_2, "battery2.png");
-    resources_load_texture(TEXTURE_BATTERY_3, "battery3.png");
-    resources_load_texture(TEXTURE_BATTERY_4, "battery4.png");
-    resources_load_texture(TEXTURE_BATTERY_5, "battery5.png");
-    resources_load_texture(TEXTURE_WIFI_DISCONNECTED, "wifi_disconnected.png");
-    resources_load_texture(TEXTURE_WIFI_0, "wifi0.png");
-    resources_load_texture(TEXTURE_WIFI_1, "wifi1.png");
-    resources_load_texture(TEXTURE_WIFI_2, "wifi2.png");
-    resources_load_texture(TEXTURE_WIFI_3, "wifi3.png");
-}
\ No newline at end of file
+    for(u32 i = 0; i < TEXTURE_COUNT; i++) {
+        if(!bundled || !overridden[i]) {
+            resources_load_texture(textures[i].id, textures[i].name);
+        }
+    }
+
+    if(!bundled && overriddenTextureCount > 0) {
+        resources_save_bundle(stamp);
+    }
+}
@@ -19,7 +19,7 @@ typedef struct {
 } systemsavedata_data;
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
 } systemsavedata_action_data;
 
@@ -27,7 +27,7 @@ static void systemsavedata_action_draw_top(ui_view* view, void* data, float x1,
     task_draw_system_save_data_info(view, ((systemsavedata_action_data*) data)->selected->data, x1, y1, x2, y2);
 }
 
-static void systemsavedata_action_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void systemsavedata_action_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     systemsavedata_action_data* actionData = (systemsavedata_action_data*) data;
 
     if(hidKeysDown() & KEY_B) {
@@ -40,7 +40,7 @@ static void systemsavedata_action_update(ui_view* view, void* data, linked_list*
     }
 
     if(selected != NULL && selected->data != NULL && (selectedTouched || (hidKeysDown() & KEY_A))) {
-        void(*action)(linked_list*, list_item*) = (void(*)(linked_list*, list_item*)) selected->data;
+        void(*action)(array_list*, list_item*) = (void(*)(array_list*, list_item*)) selected->data;
 
         ui_pop();
         list_destroy(view);
@@ -52,13 +52,13 @@ static void systemsavedata_action_update(ui_view* view, void* data, linked_list*
         return;
     }
 
-    if(linked_list_size(items) == 0) {
-        linked_list_add(items, &browse_save_data);
-        linked_list_add(items, &delete_save_data);
+    if(array_list_size(items) == 0) {
+        array_list_add(items, &browse_save_data);
+        array_list_add(items, &delete_save_data);
     }
 }
 
-static void systemsavedata_action_open(linked_list* items, list_item* selected) {
+static void systemsavedata_action_open(array_list* items, list_item* selected) {
     systemsavedata_action_data* data = (systemsavedata_action_data*) calloc(1, sizeof(systemsavedata_action_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate system save data action data.");
@@ -78,7 +78,7 @@ static void systemsavedata_draw_top(ui_view* view, void* data, float x1, float y
     }
 }
 
-static void systemsavedata_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void systemsavedata_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     systemsavedata_data* listData = (systemsavedata_data*) data;
 
     if(hidKeysDown() & KEY_B) {
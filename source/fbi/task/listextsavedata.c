@@ -60,7 +60,7 @@ static Result task_populate_ext_save_data_from(populate_ext_save_data_data* data
                                     utf16_to_utf8((uint8_t*) extSaveDataInfo->meta.publisher, smdhTitle->publisher, sizeof(extSaveDataInfo->meta.publisher) - 1);
                                     extSaveDataInfo->meta.region = smdh->region;
                                     extSaveDataInfo->meta.texture = screen_allocate_free_texture();
-                                    screen_load_texture_tiled(extSaveDataInfo->meta.texture, smdh->largeIcon, sizeof(smdh->largeIcon), 48, 48, GPU_RGB565, false);
+                                    screen_load_texture_atlas(extSaveDataInfo->meta.texture, smdh->largeIcon, sizeof(smdh->largeIcon), 48, 48, GPU_RGB565);
                                 }
                             }
 
@@ -79,7 +79,7 @@ static Result task_populate_ext_save_data_from(populate_ext_save_data_data* data
 
                         item->data = extSaveDataInfo;
 
-                        linked_list_add_sorted(data->items, item, data->userData, data->compare);
+                        array_list_add_sorted(data->items, item, data->userData, data->compare);
                     } else {
                         free(item);
 
@@ -127,18 +127,18 @@ void task_free_ext_save_data(list_item* item) {
     free(item);
 }
 
-void task_clear_ext_save_data(linked_list* items) {
+void task_clear_ext_save_data(array_list* items) {
     if(items == NULL) {
         return;
     }
 
-    linked_list_iter iter;
-    linked_list_iterate(items, &iter);
+    array_list_iter iter;
+    array_list_iterate(items, &iter);
 
-    while(linked_list_iter_has_next(&iter)) {
-        list_item* item = (list_item*) linked_list_iter_next(&iter);
+    while(array_list_iter_has_next(&iter)) {
+        list_item* item = (list_item*) array_list_iter_next(&iter);
 
-        linked_list_iter_remove(&iter);
+        array_list_iter_remove(&iter);
         task_free_ext_save_data(item);
     }
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-typedef struct linked_list_s linked_list;
+typedef struct array_list_s array_list;
 typedef struct list_item_s list_item;
 
 typedef struct ext_save_data_info_s {
@@ -12,7 +12,7 @@ typedef struct ext_save_data_info_s {
 } ext_save_data_info;
 
 typedef struct populate_ext_save_data_data_s {
-    linked_list* items;
+    array_list* items;
 
     void* userData;
     bool (*filter)(void* data, u64 extSaveDataId, FS_MediaType mediaType);
@@ -24,5 +24,5 @@ typedef struct populate_ext_save_data_data_s {
 } populate_ext_save_data_data;
 
 void task_free_ext_save_data(list_item* item);
-void task_clear_ext_save_data(linked_list* items);
+void task_clear_ext_save_data(array_list* items);
 Result task_populate_ext_save_data(populate_ext_save_data_data* data);
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <ctype.h>
 #include <malloc.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -11,22 +12,18 @@
 #include "../../core/core.h"
 
 #define MAX_FILES 1024
+#define POPULATE_FILES_WORKERS 3
+#define POPULATE_FILES_ARENA_BLOCK_SIZE 0x10000
 
 int task_compare_files(void* userData, const void* p1, const void* p2) {
-    list_item* info1 = (list_item*) p1;
-    list_item* info2 = (list_item*) p2;
+    file_info* f1 = (file_info*) ((list_item*) p1)->data;
+    file_info* f2 = (file_info*) ((list_item*) p2)->data;
 
-    bool info1Base = strncmp(info1->name, "<current directory>", LIST_ITEM_NAME_MAX) == 0 || strncmp(info1->name, "<current file>", LIST_ITEM_NAME_MAX) == 0;
-    bool info2Base = strncmp(info2->name, "<current directory>", LIST_ITEM_NAME_MAX) == 0 || strncmp(info2->name, "<current file>", LIST_ITEM_NAME_MAX) == 0;
-
-    if(info1Base && !info2Base) {
+    if(f1->isBase && !f2->isBase) {
         return -1;
-    } else if(!info1Base && info2Base) {
+    } else if(!f1->isBase && f2->isBase) {
         return 1;
     } else {
-        file_info* f1 = (file_info*) info1->data;
-        file_info* f2 = (file_info*) info2->data;
-
         if((f1->attributes & FS_ATTRIBUTE_DIRECTORY) && !(f2->attributes & FS_ATTRIBUTE_DIRECTORY)) {
             return -1;
         } else if(!(f1->attributes & FS_ATTRIBUTE_DIRECTORY) && (f2->attributes & FS_ATTRIBUTE_DIRECTORY)) {
@@ -72,7 +69,7 @@ static void task_populate_files_retrieve_meta(file_info* fileInfo) {
                                 utf16_to_utf8((uint8_t*) fileInfo->ciaInfo.meta.publisher, smdhTitle->publisher, sizeof(fileInfo->ciaInfo.meta.publisher) - 1);
                                 fileInfo->ciaInfo.meta.region = smdh->region;
                                 fileInfo->ciaInfo.meta.texture = screen_allocate_free_texture();
-                                screen_load_texture_tiled(fileInfo->ciaInfo.meta.texture, smdh->largeIcon, sizeof(smdh->largeIcon), 48, 48, GPU_RGB565, false);
+                                screen_load_texture_atlas(fileInfo->ciaInfo.meta.texture, smdh->largeIcon, sizeof(smdh->largeIcon), 48, 48, GPU_RGB565);
                             }
                         }
 
@@ -111,39 +108,68 @@ static void task_populate_files_retrieve_meta(file_info* fileInfo) {
     }
 }
 
-Result task_create_file_item(list_item** out, FS_Archive archive, const char* path, u32 attributes, bool meta) {
+// Path strings live in the item's arena. A file's name shares storage with the tail of
+// its path; directory paths end in '/', so their names get a copy of their own.
+Result task_set_file_path(file_info* info, const char* path) {
+    char name[FILE_NAME_MAX] = {'\0'};
+    string_get_path_file(name, path, FILE_NAME_MAX);
+
+    char* pathCopy = arena_strdup(info->arena, path);
+    if(pathCopy == NULL) {
+        return R_APP_OUT_OF_MEMORY;
+    }
+
+    size_t pathLen = strlen(pathCopy);
+    size_t nameLen = strlen(name);
+
+    char* nameCopy = NULL;
+    if(nameLen <= pathLen && strcmp(pathCopy + pathLen - nameLen, name) == 0) {
+        nameCopy = pathCopy + pathLen - nameLen;
+    } else if((nameCopy = arena_strdup(info->arena, name)) == NULL) {
+        return R_APP_OUT_OF_MEMORY;
+    }
+
+    info->path = pathCopy;
+    info->name = nameCopy;
+    return 0;
+}
+
+static Result task_create_file_item_in(arena* itemArena, list_item** out, FS_Archive archive, const char* path, u32 attributes, bool meta) {
     Result res = 0;
 
-    list_item* item = (list_item*) calloc(1, sizeof(list_item));
-    if(item != NULL) {
-        file_info* fileInfo = (file_info*) calloc(1, sizeof(file_info));
-        if(fileInfo != NULL) {
-            fileInfo->archive = archive;
-            string_get_path_file(fileInfo->name, path, FILE_NAME_MAX);
-            fileInfo->attributes = attributes;
-
-            fileInfo->size = 0;
-            fileInfo->isCia = false;
-            fileInfo->isTicket = false;
-
-            if((attributes & FS_ATTRIBUTE_DIRECTORY) || fs_is_dir(archive, path)) {
-                item->color = COLOR_DIRECTORY;
-
-                size_t len = strlen(path);
-                if(len == 0 || path[len - 1] != '/') {
-                    snprintf(fileInfo->path, FILE_PATH_MAX, "%s/", path);
-                } else {
-                    string_copy(fileInfo->path, path, FILE_PATH_MAX);
-                }
+    list_item* item = (list_item*) arena_alloc(itemArena, sizeof(list_item));
+    file_info* fileInfo = item != NULL ? (file_info*) arena_alloc(itemArena, sizeof(file_info)) : NULL;
+    if(fileInfo != NULL) {
+        fileInfo->arena = itemArena;
+        fileInfo->archive = archive;
+        fileInfo->attributes = attributes;
 
-                if(attributes == 0) {
-                    fileInfo->attributes = FS_ATTRIBUTE_DIRECTORY;
-                }
+        fileInfo->isBase = false;
+
+        fileInfo->size = 0;
+        fileInfo->isCia = false;
+        fileInfo->isTicket = false;
+
+        if((attributes & FS_ATTRIBUTE_DIRECTORY) || fs_is_dir(archive, path)) {
+            item->color = COLOR_DIRECTORY;
+
+            size_t len = strlen(path);
+            if(len == 0 || path[len - 1] != '/') {
+                char dirPath[FILE_PATH_MAX] = {'\0'};
+                snprintf(dirPath, FILE_PATH_MAX, "%s/", path);
+
+                res = task_set_file_path(fileInfo, dirPath);
             } else {
-                item->color = COLOR_FILE;
+                res = task_set_file_path(fileInfo, path);
+            }
 
-                string_copy(fileInfo->path, path, FILE_PATH_MAX);
+            if(attributes == 0) {
+                fileInfo->attributes = FS_ATTRIBUTE_DIRECTORY;
+            }
+        } else {
+            item->color = COLOR_FILE;
 
+            if(R_SUCCEEDED(res = task_set_file_path(fileInfo, path))) {
                 if(fs_filter_cias(NULL, fileInfo->path, fileInfo->attributes)) {
                     fileInfo->isCia = true;
                 } else if(fs_filter_tickets(NULL, fileInfo->path, fileInfo->attributes)) {
@@ -154,15 +180,16 @@ Result task_create_file_item(list_item** out, FS_Archive archive, const char* pa
                     task_populate_files_retrieve_meta(fileInfo);
                 }
             }
+        }
 
+        if(R_SUCCEEDED(res)) {
             string_copy(item->name, fileInfo->name, LIST_ITEM_NAME_MAX);
             item->data = fileInfo;
 
-            *out = item;
-        } else {
-            free(item);
+            // Each item holds a reference; the arena's blocks go when the last one is freed.
+            arena_retain(itemArena);
 
-            res = R_APP_OUT_OF_MEMORY;
+            *out = item;
         }
     } else {
         res = R_APP_OUT_OF_MEMORY;
@@ -171,125 +198,480 @@ Result task_create_file_item(list_item** out, FS_Archive archive, const char* pa
     return res;
 }
 
-static int task_populate_files_compare_directory_entries(const void* e1, const void* e2) {
-    FS_DirectoryEntry* ent1 = (FS_DirectoryEntry*) e1;
-    FS_DirectoryEntry* ent2 = (FS_DirectoryEntry*) e2;
+Result task_create_file_item(list_item** out, FS_Archive archive, const char* path, u32 attributes, bool meta) {
+    arena* itemArena = arena_create(sizeof(list_item) + sizeof(file_info) + FILE_PATH_MAX);
+    if(itemArena == NULL) {
+        return R_APP_OUT_OF_MEMORY;
+    }
+
+    Result res = task_create_file_item_in(itemArena, out, archive, path, attributes, meta);
+
+    arena_release(itemArena);
+    return res;
+}
+
+typedef struct {
+    u32 prefix;
+    u32 attributes;
+    const char* name;
+    const char* key;
+} populate_files_entry;
+
+static int task_populate_files_compare_entries(const void* e1, const void* e2) {
+    populate_files_entry* ent1 = (populate_files_entry*) e1;
+    populate_files_entry* ent2 = (populate_files_entry*) e2;
 
     if((ent1->attributes & FS_ATTRIBUTE_DIRECTORY) && !(ent2->attributes & FS_ATTRIBUTE_DIRECTORY)) {
         return -1;
     } else if(!(ent1->attributes & FS_ATTRIBUTE_DIRECTORY) && (ent2->attributes & FS_ATTRIBUTE_DIRECTORY)) {
         return 1;
+    } else if(ent1->prefix != ent2->prefix) {
+        return ent1->prefix < ent2->prefix ? -1 : 1;
     } else {
-        char entryName1[0x213] = {'\0'};
-        utf16_to_utf8((uint8_t*) entryName1, ent1->name, sizeof(entryName1) - 1);
+        return strcmp(ent1->key, ent2->key);
+    }
+}
+
+// Transcodes and case folds each entry name once into a packed name/key buffer, so sorting
+// only compares key prefixes and, on ties, already folded UTF-8 strings.
+static Result task_populate_files_sort_entries(populate_files_entry** entriesOut, char** namesOut, FS_DirectoryEntry* dirEntries, u32 entryCount) {
+    u32 namesSize = 0;
+    for(u32 i = 0; i < entryCount; i++) {
+        u32 units = 0;
+        while(units < sizeof(dirEntries[i].name) / sizeof(u16) && dirEntries[i].name[units] != 0) {
+            units++;
+        }
 
-        char entryName2[0x213] = {'\0'};
-        utf16_to_utf8((uint8_t*) entryName2, ent2->name, sizeof(entryName2) - 1);
+        u32 maxLen = units * 3 < FILE_NAME_MAX - 1 ? units * 3 : FILE_NAME_MAX - 1;
+        namesSize += (maxLen + 1) * 2;
+    }
+
+    populate_files_entry* entries = (populate_files_entry*) calloc(entryCount, sizeof(populate_files_entry));
+    if(entries == NULL) {
+        return R_APP_OUT_OF_MEMORY;
+    }
 
-        return strncasecmp(entryName1, entryName2, sizeof(entryName1));
+    char* names = (char*) malloc(namesSize);
+    if(names == NULL) {
+        free(entries);
+        return R_APP_OUT_OF_MEMORY;
     }
+
+    char* curr = names;
+    for(u32 i = 0; i < entryCount; i++) {
+        char name[FILE_NAME_MAX] = {'\0'};
+        utf16_to_utf8((uint8_t*) name, dirEntries[i].name, FILE_NAME_MAX - 1);
+
+        u32 len = strlen(name);
+
+        char* entryName = curr;
+        char* entryKey = curr + len + 1;
+        curr += (len + 1) * 2;
+
+        memcpy(entryName, name, len + 1);
+        for(u32 j = 0; j <= len; j++) {
+            entryKey[j] = (char) tolower((u8) name[j]);
+        }
+
+        u8 prefix[4] = {0};
+        memcpy(prefix, entryKey, len < sizeof(prefix) ? len : sizeof(prefix));
+
+        entries[i].prefix = ((u32) prefix[0] << 24) | ((u32) prefix[1] << 16) | ((u32) prefix[2] << 8) | (u32) prefix[3];
+        entries[i].attributes = dirEntries[i].attributes;
+        entries[i].name = entryName;
+        entries[i].key = entryKey;
+    }
+
+    qsort(entries, entryCount, sizeof(populate_files_entry), task_populate_files_compare_entries);
+
+    *entriesOut = entries;
+    *namesOut = names;
+    return 0;
 }
 
-static void task_populate_files_thread(void* arg) {
-    populate_files_data* data = (populate_files_data*) arg;
+typedef struct populate_files_dir_s {
+    list_item* item;
+    array_list files;
+    array_list dirs;
+} populate_files_dir;
+
+typedef struct {
+    Handle mutex;
+    array_list dirs;
+} populate_files_deque;
+
+typedef struct {
+    populate_files_data* data;
+
+    populate_files_deque deques[POPULATE_FILES_WORKERS];
+    u32 workerCount;
+
+    // Counts queued directories, so idle workers block until there is one to take. Also
+    // released once per worker when the walk ends, to wake them all up to exit.
+    Handle available;
+
+    Handle mutex;
+    u32 pending;
+    bool quit;
+    Result result;
+} populate_files_walk;
+
+typedef struct {
+    populate_files_walk* walk;
+    u32 index;
+    FS_DirectoryEntry* entries;
+    arena* arena;
+} populate_files_worker;
+
+static populate_files_dir* task_populate_files_create_dir(arena* dirArena, list_item* item) {
+    populate_files_dir* dir = (populate_files_dir*) arena_alloc(dirArena, sizeof(populate_files_dir));
+    if(dir != NULL) {
+        dir->item = item;
+        array_list_init(&dir->files);
+        array_list_init(&dir->dirs);
+    }
 
-    Result res = 0;
+    return dir;
+}
 
-    list_item* baseItem = NULL;
-    if(R_SUCCEEDED(res = task_create_file_item(&baseItem, data->archive, data->path, 0, false))) {
-        file_info* baseInfo = (file_info*) baseItem->data;
-        if(baseInfo->attributes & FS_ATTRIBUTE_DIRECTORY) {
-            string_copy(baseItem->name, "<current directory>", LIST_ITEM_NAME_MAX);
-        } else {
-            string_copy(baseItem->name, "<current file>", LIST_ITEM_NAME_MAX);
+static bool task_populate_files_push_dir(populate_files_walk* walk, u32 index, populate_files_dir* dir) {
+    svcWaitSynchronization(walk->mutex, U64_MAX);
+    walk->pending++;
+    svcReleaseMutex(walk->mutex);
+
+    populate_files_deque* deque = &walk->deques[index];
+
+    svcWaitSynchronization(deque->mutex, U64_MAX);
+    bool added = array_list_add(&deque->dirs, dir);
+    svcReleaseMutex(deque->mutex);
+
+    if(added) {
+        s32 count = 0;
+        svcReleaseSemaphore(&count, walk->available, 1);
+    } else {
+        svcWaitSynchronization(walk->mutex, U64_MAX);
+        walk->pending--;
+        svcReleaseMutex(walk->mutex);
+    }
+
+    return added;
+}
+
+// Workers pop their own most recently queued directory, keeping traversal depth-first and
+// local, and steal the oldest directory from another worker's deque when theirs runs dry.
+static populate_files_dir* task_populate_files_take_dir(populate_files_walk* walk, u32 index) {
+    populate_files_dir* dir = NULL;
+
+    for(u32 i = 0; i < walk->workerCount && dir == NULL; i++) {
+        populate_files_deque* deque = &walk->deques[(index + i) % walk->workerCount];
+
+        svcWaitSynchronization(deque->mutex, U64_MAX);
+
+        u32 size = array_list_size(&deque->dirs);
+        if(size > 0) {
+            u32 pos = i == 0 ? size - 1 : 0;
+
+            dir = (populate_files_dir*) array_list_get(&deque->dirs, pos);
+            array_list_remove_at(&deque->dirs, pos);
         }
 
-        linked_list queue;
-        linked_list_init(&queue);
+        svcReleaseMutex(deque->mutex);
+    }
 
-        linked_list_add(&queue, baseItem);
+    return dir;
+}
 
-        bool quit = false;
-        while(!quit && R_SUCCEEDED(res) && linked_list_size(&queue) > 0) {
-            u32 tail = linked_list_size(&queue) - 1;
-            list_item* currItem = (list_item*) linked_list_get(&queue, tail);
-            file_info* curr = (file_info*) currItem->data;
-            linked_list_remove_at(&queue, tail);
+static Result task_populate_files_read_dir(populate_files_worker* worker, populate_files_dir* dir) {
+    populate_files_walk* walk = worker->walk;
+    populate_files_data* data = walk->data;
+    file_info* curr = (file_info*) dir->item->data;
 
-            if(data->includeBase || currItem != baseItem) {
-                linked_list_add(data->items, currItem);
-            }
+    Result res = 0;
 
-            if(curr->attributes & FS_ATTRIBUTE_DIRECTORY) {
-                FS_Path* fsPath = fs_make_path_utf8(curr->path);
-                if(fsPath != NULL) {
-                    Handle dirHandle = 0;
-                    if(R_SUCCEEDED(res = FSUSER_OpenDirectory(&dirHandle, curr->archive, *fsPath))) {
-                        u32 entryCount = 0;
-                        FS_DirectoryEntry* entries = (FS_DirectoryEntry*) calloc(MAX_FILES, sizeof(FS_DirectoryEntry));
-                        if(entries != NULL) {
-                            if(R_SUCCEEDED(res = FSDIR_Read(dirHandle, &entryCount, MAX_FILES, entries)) && entryCount > 0) {
-                                qsort(entries, entryCount, sizeof(FS_DirectoryEntry), task_populate_files_compare_directory_entries);
-
-                                for(u32 i = 0; i < entryCount && R_SUCCEEDED(res); i++) {
-                                    svcWaitSynchronization(task_get_pause_event(), U64_MAX);
-                                    if(task_is_quit_all() || svcWaitSynchronization(data->cancelEvent, 0) == 0) {
-                                        quit = true;
-                                        break;
-                                    }
+    FS_Path* fsPath = fs_make_path_utf8(curr->path);
+    if(fsPath != NULL) {
+        Handle dirHandle = 0;
+        if(R_SUCCEEDED(res = FSUSER_OpenDirectory(&dirHandle, curr->archive, *fsPath))) {
+            u32 entryCount = 0;
+            populate_files_entry* sorted = NULL;
+            char* names = NULL;
+            if(R_SUCCEEDED(res = FSDIR_Read(dirHandle, &entryCount, MAX_FILES, worker->entries)) && entryCount > 0 && R_SUCCEEDED(res = task_populate_files_sort_entries(&sorted, &names, worker->entries, entryCount))) {
+                for(u32 i = 0; i < entryCount && R_SUCCEEDED(res); i++) {
+                    svcWaitSynchronization(task_get_pause_event(), U64_MAX);
+                    if(task_is_quit_all() || svcWaitSynchronization(data->cancelEvent, 0) == 0 || __atomic_load_n(&walk->quit, __ATOMIC_ACQUIRE)) {
+                        __atomic_store_n(&walk->quit, true, __ATOMIC_RELEASE);
+                        break;
+                    }
 
-                                    char name[FILE_NAME_MAX] = {'\0'};
-                                    utf16_to_utf8((uint8_t*) name, entries[i].name, FILE_NAME_MAX - 1);
-
-                                    if(data->filter == NULL || data->filter(data->filterData, name, entries[i].attributes)) {
-                                        char path[FILE_PATH_MAX] = {'\0'};
-                                        snprintf(path, FILE_PATH_MAX, "%s%s", curr->path, name);
-
-                                        list_item* item = NULL;
-                                        if(R_SUCCEEDED(res = task_create_file_item(&item, curr->archive, path, entries[i].attributes, false))) {
-                                            if(data->recursive && (((file_info*) item->data)->attributes & FS_ATTRIBUTE_DIRECTORY)) {
-                                                linked_list_add(&queue, item);
-                                            } else {
-                                                linked_list_add(data->items, item);
-                                            }
-                                        }
+                    const char* name = sorted[i].name;
+                    u32 attributes = sorted[i].attributes;
+
+                    if(data->filter == NULL || data->filter(data->filterData, name, attributes)) {
+                        char path[FILE_PATH_MAX] = {'\0'};
+                        snprintf(path, FILE_PATH_MAX, "%s%s", curr->path, name);
+
+                        list_item* item = NULL;
+                        if(R_SUCCEEDED(res = task_create_file_item_in(worker->arena, &item, curr->archive, path, attributes, false))) {
+                            if(data->recursive && (((file_info*) item->data)->attributes & FS_ATTRIBUTE_DIRECTORY)) {
+                                populate_files_dir* subDir = task_populate_files_create_dir(worker->arena, item);
+                                if(subDir != NULL) {
+                                    if(!array_list_add(&dir->dirs, subDir)) {
+                                        task_free_file(item);
+
+                                        res = R_APP_OUT_OF_MEMORY;
+                                    } else if(!task_populate_files_push_dir(walk, worker->index, subDir)) {
+                                        res = R_APP_OUT_OF_MEMORY;
                                     }
+                                } else {
+                                    task_free_file(item);
+
+                                    res = R_APP_OUT_OF_MEMORY;
                                 }
+                            } else if(!data->recursive) {
+                                // Only the base directory is read, so there is no tree to wait for.
+                                array_list_add(data->items, item);
+                            } else {
+                                array_list_add(&dir->files, item);
                             }
-
-                            free(entries);
-                        } else {
-                            res = R_APP_OUT_OF_MEMORY;
                         }
-
-                        FSDIR_Close(dirHandle);
                     }
+                }
 
-                    fs_free_path_utf8(fsPath);
-                } else {
+                free(names);
+                free(sorted);
+            }
+
+            FSDIR_Close(dirHandle);
+        }
+
+        fs_free_path_utf8(fsPath);
+    } else {
+        res = R_APP_OUT_OF_MEMORY;
+    }
+
+    return res;
+}
+
+static void task_populate_files_worker_thread(void* arg) {
+    populate_files_worker* worker = (populate_files_worker*) arg;
+    populate_files_walk* walk = worker->walk;
+
+    while(true) {
+        svcWaitSynchronization(walk->available, U64_MAX);
+
+        svcWaitSynchronization(walk->mutex, U64_MAX);
+        bool done = __atomic_load_n(&walk->quit, __ATOMIC_ACQUIRE) || R_FAILED(walk->result) || walk->pending == 0;
+        svcReleaseMutex(walk->mutex);
+
+        if(done) {
+            break;
+        }
+
+        // Each count taken from available is backed by a queued directory.
+        populate_files_dir* dir = task_populate_files_take_dir(walk, worker->index);
+        if(dir == NULL) {
+            continue;
+        }
+
+        Result res = task_populate_files_read_dir(worker, dir);
+
+        svcWaitSynchronization(walk->mutex, U64_MAX);
+
+        if(R_FAILED(res) && R_SUCCEEDED(walk->result)) {
+            walk->result = res;
+        }
+
+        walk->pending--;
+
+        bool finished = __atomic_load_n(&walk->quit, __ATOMIC_ACQUIRE) || R_FAILED(walk->result) || walk->pending == 0;
+
+        svcReleaseMutex(walk->mutex);
+
+        if(finished) {
+            s32 count = 0;
+            svcReleaseSemaphore(&count, walk->available, (s32) walk->workerCount);
+        }
+    }
+}
+
+// Flattens the directory tree in pre-order: each directory, then its files, then its
+// subdirectories in sorted order. Parents always precede their children regardless of
+// which worker read them.
+static void task_populate_files_flatten(populate_files_data* data, populate_files_dir* root) {
+    array_list stack;
+    array_list_init(&stack);
+
+    array_list_add(&stack, root);
+
+    while(array_list_size(&stack) > 0) {
+        u32 tail = array_list_size(&stack) - 1;
+        populate_files_dir* dir = (populate_files_dir*) array_list_get(&stack, tail);
+        array_list_remove_at(&stack, tail);
+
+        if(data->includeBase || dir != root) {
+            array_list_add(data->items, dir->item);
+        } else {
+            task_free_file(dir->item);
+        }
+
+        array_list_iter iter;
+        array_list_iterate(&dir->files, &iter);
+
+        while(array_list_iter_has_next(&iter)) {
+            array_list_add(data->items, array_list_iter_next(&iter));
+        }
+
+        for(int i = (int) array_list_size(&dir->dirs) - 1; i >= 0; i--) {
+            array_list_add(&stack, array_list_get(&dir->dirs, (u32) i));
+        }
+
+        array_list_destroy(&dir->files);
+        array_list_destroy(&dir->dirs);
+    }
+
+    array_list_destroy(&stack);
+}
+
+static Result task_populate_files_walk(populate_files_data* data, list_item* baseItem) {
+    if(!(((file_info*) baseItem->data)->attributes & FS_ATTRIBUTE_DIRECTORY)) {
+        if(data->includeBase) {
+            array_list_add(data->items, baseItem);
+        } else {
+            task_free_file(baseItem);
+        }
+
+        return 0;
+    }
+
+    populate_files_walk walk;
+    memset(&walk, 0, sizeof(walk));
+
+    walk.data = data;
+    walk.workerCount = data->recursive ? POPULATE_FILES_WORKERS : 1;
+
+    if(!data->recursive && data->includeBase) {
+        array_list_add(data->items, baseItem);
+    }
+
+    populate_files_worker workers[POPULATE_FILES_WORKERS];
+    memset(workers, 0, sizeof(workers));
+
+    populate_files_dir* root = NULL;
+
+    Result res = 0;
+
+    if(R_SUCCEEDED(res = svcCreateMutex(&walk.mutex, false)) && R_SUCCEEDED(res = svcCreateSemaphore(&walk.available, 0, 0x7FFFFFFF))) {
+        for(u32 i = 0; i < walk.workerCount && R_SUCCEEDED(res); i++) {
+            array_list_init(&walk.deques[i].dirs);
+
+            workers[i].walk = &walk;
+            workers[i].index = i;
+
+            if(R_SUCCEEDED(res = svcCreateMutex(&walk.deques[i].mutex, false))) {
+                workers[i].entries = (FS_DirectoryEntry*) calloc(MAX_FILES, sizeof(FS_DirectoryEntry));
+                workers[i].arena = arena_create(POPULATE_FILES_ARENA_BLOCK_SIZE);
+                if(workers[i].entries == NULL || workers[i].arena == NULL) {
                     res = R_APP_OUT_OF_MEMORY;
                 }
             }
         }
 
-        linked_list_destroy(&queue);
+        if(R_SUCCEEDED(res) && (root = task_populate_files_create_dir(workers[0].arena, baseItem)) == NULL) {
+            res = R_APP_OUT_OF_MEMORY;
+        }
+
+        if(R_SUCCEEDED(res) && !task_populate_files_push_dir(&walk, 0, root)) {
+            res = R_APP_OUT_OF_MEMORY;
+        }
+
+        if(R_SUCCEEDED(res)) {
+            // The populating thread acts as the first worker.
+            Thread threads[POPULATE_FILES_WORKERS] = {NULL};
+            for(u32 i = 1; i < walk.workerCount; i++) {
+                threads[i] = threadCreate(task_populate_files_worker_thread, &workers[i], 0x10000, 0x19, 1, false);
+            }
+
+            task_populate_files_worker_thread(&workers[0]);
+
+            for(u32 i = 1; i < walk.workerCount; i++) {
+                if(threads[i] != NULL) {
+                    threadJoin(threads[i], U64_MAX);
+                    threadFree(threads[i]);
+                }
+            }
+
+            res = walk.result;
+        }
+
+        for(u32 i = 0; i < walk.workerCount; i++) {
+            if(walk.deques[i].mutex != 0) {
+                svcCloseHandle(walk.deques[i].mutex);
+            }
+
+            array_list_destroy(&walk.deques[i].dirs);
+
+            if(workers[i].entries != NULL) {
+                free(workers[i].entries);
+            }
+        }
+
+        svcCloseHandle(walk.available);
+    }
+
+    if(walk.mutex != 0) {
+        svcCloseHandle(walk.mutex);
+    }
 
+    if(!data->recursive) {
+        // Items were published as they were read.
         if(!data->includeBase) {
             task_free_file(baseItem);
         }
+    } else if(root != NULL) {
+        // Directories left unread after a cancel or failure are still part of the tree.
+        task_populate_files_flatten(data, root);
+    } else {
+        task_free_file(baseItem);
+    }
+
+    // Directory nodes are gone once flattened; the items keep their arenas alive from here.
+    for(u32 i = 0; i < walk.workerCount; i++) {
+        arena_release(workers[i].arena);
+    }
+
+    return res;
+}
+
+static void task_populate_files_thread(void* arg) {
+    populate_files_data* data = (populate_files_data*) arg;
+
+    Result res = 0;
+
+    list_item* baseItem = NULL;
+    if(R_SUCCEEDED(res = task_create_file_item(&baseItem, data->archive, data->path, 0, false))) {
+        file_info* baseInfo = (file_info*) baseItem->data;
+        baseInfo->isBase = true;
+
+        if(baseInfo->attributes & FS_ATTRIBUTE_DIRECTORY) {
+            string_copy(baseItem->name, "<current directory>", LIST_ITEM_NAME_MAX);
+        } else {
+            string_copy(baseItem->name, "<current file>", LIST_ITEM_NAME_MAX);
+        }
+
+        res = task_populate_files_walk(data, baseItem);
     }
 
     if(R_SUCCEEDED(res) && data->meta) {
-        linked_list_iter iter;
-        linked_list_iterate(data->items, &iter);
+        array_list_iter iter;
+        array_list_iterate(data->items, &iter);
 
-        while(linked_list_iter_has_next(&iter)) {
+        while(array_list_iter_has_next(&iter)) {
             svcWaitSynchronization(task_get_pause_event(), U64_MAX);
             if(task_is_quit_all() || svcWaitSynchronization(data->cancelEvent, 0) == 0) {
                 break;
             }
 
-            list_item* item = (list_item*) linked_list_iter_next(&iter);
+            list_item* item = (list_item*) array_list_iter_next(&iter);
             file_info* fileInfo = (file_info*) item->data;
 
             task_populate_files_retrieve_meta(fileInfo);
@@ -313,28 +695,69 @@ void task_free_file(list_item* item) {
             screen_unload_texture(fileInfo->ciaInfo.meta.texture);
         }
 
-        free(item->data);
+        arena_release(fileInfo->arena);
     }
-
-    free(item);
 }
 
-void task_clear_files(linked_list* items) {
+void task_clear_files(array_list* items) {
     if(items == NULL) {
         return;
     }
 
-    linked_list_iter iter;
-    linked_list_iterate(items, &iter);
+    array_list_iter iter;
+    array_list_iterate(items, &iter);
 
-    while(linked_list_iter_has_next(&iter)) {
-        list_item* item = (list_item*) linked_list_iter_next(&iter);
+    while(array_list_iter_has_next(&iter)) {
+        list_item* item = (list_item*) array_list_iter_next(&iter);
 
-        linked_list_iter_remove(&iter);
+        array_list_iter_remove(&iter);
         task_free_file(item);
     }
 }
 
+// Removes and frees the listing item with the given path. The path index is built from the
+// listing on first use and kept in sync, so removing many items doesn't rescan the listing.
+void task_remove_file(array_list* items, string_map* index, const char* path) {
+    if(items == NULL || index == NULL || path == NULL) {
+        return;
+    }
+
+    if(string_map_size(index) == 0) {
+        array_list_iter iter;
+        array_list_iterate(items, &iter);
+
+        while(array_list_iter_has_next(&iter)) {
+            list_item* item = (list_item*) array_list_iter_next(&iter);
+
+            if(!string_map_put(index, ((file_info*) item->data)->path, item)) {
+                string_map_clear(index);
+                break;
+            }
+        }
+    }
+
+    list_item* item = (list_item*) string_map_get(index, path);
+    if(item != NULL) {
+        string_map_remove(index, path);
+
+        array_list_remove(items, item);
+        task_free_file(item);
+    } else if(string_map_size(index) == 0) {
+        // Index could not be allocated.
+        array_list_iter iter;
+        array_list_iterate(items, &iter);
+
+        while(array_list_iter_has_next(&iter)) {
+            item = (list_item*) array_list_iter_next(&iter);
+
+            if(strncmp(((file_info*) item->data)->path, path, FILE_PATH_MAX) == 0) {
+                array_list_iter_remove(&iter);
+                task_free_file(item);
+            }
+        }
+    }
+}
+
 Result task_populate_files(populate_files_data* data) {
     if(data == NULL || data->items == NULL) {
         return R_APP_INVALID_ARGUMENT;
@@ -5,8 +5,10 @@
 #define FILE_PATH_MAX 512
 #endif
 
-typedef struct linked_list_s linked_list;
+typedef struct arena_s arena;
+typedef struct array_list_s array_list;
 typedef struct list_item_s list_item;
+typedef struct string_map_s string_map;
 
 typedef struct cia_info_s {
     bool loaded;
@@ -19,10 +21,13 @@ typedef struct cia_info_s {
 } cia_info;
 
 typedef struct file_info_s {
+    arena* arena;
+
     FS_Archive archive;
-    char name[FILE_NAME_MAX];
-    char path[FILE_PATH_MAX];
+    char* name;
+    char* path;
     u32 attributes;
+    bool isBase;
 
     // Files only
     u64 size;
@@ -33,7 +38,7 @@ typedef struct file_info_s {
 } file_info;
 
 typedef struct populate_files_data_s {
-    linked_list* items;
+    array_list* items;
 
     FS_Archive archive;
     char path[FILE_PATH_MAX];
@@ -52,6 +57,8 @@ typedef struct populate_files_data_s {
 
 int task_compare_files(void* userData, const void* p1, const void* p2);
 void task_free_file(list_item* item);
-void task_clear_files(linked_list* items);
+void task_clear_files(array_list* items);
+void task_remove_file(array_list* items, string_map* index, const char* path);
+Result task_set_file_path(file_info* info, const char* path);
 Result task_create_file_item(list_item** out, FS_Archive archive, const char* path, u32 attributes, bool meta);
 Result task_populate_files(populate_files_data* data);
\ No newline at end of file
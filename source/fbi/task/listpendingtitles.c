@@ -51,7 +51,7 @@ static Result task_populate_pending_titles_from(populate_pending_titles_data* da
 
                                     item->data = pendingTitleInfo;
 
-                                    linked_list_add(data->items, item);
+                                    array_list_add(data->items, item);
                                 } else {
                                     free(item);
 
@@ -105,18 +105,18 @@ void task_free_pending_title(list_item* item) {
     free(item);
 }
 
-void task_clear_pending_titles(linked_list* items) {
+void task_clear_pending_titles(array_list* items) {
     if(items == NULL) {
         return;
     }
 
-    linked_list_iter iter;
-    linked_list_iterate(items, &iter);
+    array_list_iter iter;
+    array_list_iterate(items, &iter);
 
-    while(linked_list_iter_has_next(&iter)) {
-        list_item* item = (list_item*) linked_list_iter_next(&iter);
+    while(array_list_iter_has_next(&iter)) {
+        list_item* item = (list_item*) array_list_iter_next(&iter);
 
-        linked_list_iter_remove(&iter);
+        array_list_iter_remove(&iter);
         task_free_pending_title(item);
     }
 }
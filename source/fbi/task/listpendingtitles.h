@@ -1,6 +1,6 @@
 #pragma once
 
-typedef struct linked_list_s linked_list;
+typedef struct array_list_s array_list;
 typedef struct list_item_s list_item;
 
 typedef struct pending_title_info_s {
@@ -10,7 +10,7 @@ typedef struct pending_title_info_s {
 } pending_title_info;
 
 typedef struct populate_pending_titles_data_s {
-    linked_list* items;
+    array_list* items;
 
     volatile bool finished;
     Result result;
@@ -18,5 +18,5 @@ typedef struct populate_pending_titles_data_s {
 } populate_pending_titles_data;
 
 void task_free_pending_title(list_item* item);
-void task_clear_pending_titles(linked_list* items);
+void task_clear_pending_titles(array_list* items);
 Result task_populate_pending_titles(populate_pending_titles_data* data);
\ No newline at end of file
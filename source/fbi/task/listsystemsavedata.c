@@ -43,7 +43,7 @@ static void task_populate_system_save_data_thread(void* arg) {
                     item->color = COLOR_TEXT;
                     item->data = systemSaveDataInfo;
 
-                    linked_list_add(data->items, item);
+                    array_list_add(data->items, item);
                 } else {
                     free(item);
 
@@ -73,18 +73,18 @@ void task_free_system_save_data(list_item* item) {
     free(item);
 }
 
-void task_clear_system_save_data(linked_list* items) {
+void task_clear_system_save_data(array_list* items) {
     if(items == NULL) {
         return;
     }
 
-    linked_list_iter iter;
-    linked_list_iterate(items, &iter);
+    array_list_iter iter;
+    array_list_iterate(items, &iter);
 
-    while(linked_list_iter_has_next(&iter)) {
-        list_item* item = (list_item*) linked_list_iter_next(&iter);
+    while(array_list_iter_has_next(&iter)) {
+        list_item* item = (list_item*) array_list_iter_next(&iter);
 
-        linked_list_iter_remove(&iter);
+        array_list_iter_remove(&iter);
         task_free_system_save_data(item);
     }
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-typedef struct linked_list_s linked_list;
+typedef struct array_list_s array_list;
 typedef struct list_item_s list_item;
 
 typedef struct system_save_data_info_s {
@@ -8,7 +8,7 @@ typedef struct system_save_data_info_s {
 } system_save_data_info;
 
 typedef struct populate_system_save_data_data_s {
-    linked_list* items;
+    array_list* items;
 
     volatile bool finished;
     Result result;
@@ -16,5 +16,5 @@ typedef struct populate_system_save_data_data_s {
 } populate_system_save_data_data;
 
 void task_free_system_save_data(list_item* item);
-void task_clear_system_save_data(linked_list* items);
+void task_clear_system_save_data(array_list* items);
 Result task_populate_system_save_data(populate_system_save_data_data* data);
\ No newline at end of file
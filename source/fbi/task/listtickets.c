@@ -15,24 +15,42 @@ static int task_populate_tickets_compare_ids(const void* e1, const void* e2) {
     return id1 > id2 ? 1 : id1 < id2 ? -1 : 0;
 }
 
-void task_populate_tickets_update_use(list_item* item) {
-    if(item == NULL) {
-        return;
-    }
+// Fetches the installed NAND and SD title lists once, so tickets can be classified without
+// an AM_GetTitleInfo call each. A ticket is in use if its title is installed on either.
+static Result task_populate_tickets_get_installed(hash_map* installed) {
+    Result res = 0;
 
-    ticket_info* info = (ticket_info*) item->data;
+    u32 counts[2] = {0, 0};
+    u64* titleIds[2] = {NULL, NULL};
+
+    for(FS_MediaType mediaType = MEDIATYPE_NAND; mediaType != MEDIATYPE_GAME_CARD && R_SUCCEEDED(res); mediaType++) {
+        u32 count = 0;
+        if(R_SUCCEEDED(res = AM_GetTitleCount(mediaType, &count)) && count > 0) {
+            titleIds[mediaType] = (u64*) calloc(count, sizeof(u64));
+            if(titleIds[mediaType] != NULL) {
+                res = AM_GetTitleList(&counts[mediaType], mediaType, count, titleIds[mediaType]);
+            } else {
+                res = R_APP_OUT_OF_MEMORY;
+            }
+        }
+    }
 
-    info->inUse = false;
+    for(u32 i = 0; i < 2 && R_SUCCEEDED(res); i++) {
+        for(u32 j = 0; j < counts[i]; j++) {
+            if(!hash_map_put(installed, titleIds[i][j], NULL)) {
+                res = R_APP_OUT_OF_MEMORY;
+                break;
+            }
+        }
+    }
 
-    AM_TitleEntry entry;
-    for(FS_MediaType mediaType = MEDIATYPE_NAND; mediaType != MEDIATYPE_GAME_CARD; mediaType++) {
-        if(R_SUCCEEDED(AM_GetTitleInfo(mediaType, 1, &info->titleId, &entry))) {
-            info->inUse = true;
-            break;
+    for(u32 i = 0; i < 2; i++) {
+        if(titleIds[i] != NULL) {
+            free(titleIds[i]);
         }
     }
 
-    item->color = info->inUse ? COLOR_TICKET_IN_USE : COLOR_TICKET_NOT_IN_USE;
+    return res;
 }
 
 static void task_populate_tickets_thread(void* arg) {
@@ -40,8 +58,11 @@ static void task_populate_tickets_thread(void* arg) {
 
     Result res = 0;
 
+    hash_map installed;
+    hash_map_init(&installed);
+
     u32 ticketCount = 0;
-    if(R_SUCCEEDED(res = AM_GetTicketCount(&ticketCount))) {
+    if(R_SUCCEEDED(res = task_populate_tickets_get_installed(&installed)) && R_SUCCEEDED(res = AM_GetTicketCount(&ticketCount))) {
         u64* ticketIds = (u64*) calloc(ticketCount, sizeof(u64));
         if(ticketIds != NULL) {
             if(R_SUCCEEDED(res = AM_GetTicketList(&ticketCount, ticketCount, 0, ticketIds))) {
@@ -59,13 +80,13 @@ static void task_populate_tickets_thread(void* arg) {
                         if(ticketInfo != NULL) {
                             ticketInfo->titleId = ticketIds[i];
                             ticketInfo->loaded = true;
+                            ticketInfo->inUse = hash_map_contains(&installed, ticketIds[i]);
 
                             snprintf(item->name, LIST_ITEM_NAME_MAX, "%016llX", ticketIds[i]);
+                            item->color = ticketInfo->inUse ? COLOR_TICKET_IN_USE : COLOR_TICKET_NOT_IN_USE;
                             item->data = ticketInfo;
 
-                            task_populate_tickets_update_use(item);
-
-                            linked_list_add(data->items, item);
+                            array_list_add(data->items, item);
                         } else {
                             free(item);
 
@@ -83,6 +104,8 @@ static void task_populate_tickets_thread(void* arg) {
         }
     }
 
+    hash_map_destroy(&installed);
+
     svcCloseHandle(data->cancelEvent);
 
     data->result = res;
@@ -101,18 +124,18 @@ void task_free_ticket(list_item* item) {
     free(item);
 }
 
-void task_clear_tickets(linked_list* items) {
+void task_clear_tickets(array_list* items) {
     if(items == NULL) {
         return;
     }
 
-    linked_list_iter iter;
-    linked_list_iterate(items, &iter);
+    array_list_iter iter;
+    array_list_iterate(items, &iter);
 
-    while(linked_list_iter_has_next(&iter)) {
-        list_item* item = (list_item*) linked_list_iter_next(&iter);
+    while(array_list_iter_has_next(&iter)) {
+        list_item* item = (list_item*) array_list_iter_next(&iter);
 
-        linked_list_iter_remove(&iter);
+        array_list_iter_remove(&iter);
         task_free_ticket(item);
     }
 }
@@ -10,79 +10,596 @@
 #include "../resources.h"
 #include "../../core/core.h"
 
-static Result task_populate_titles_add_ctr(populate_titles_data* data, FS_MediaType mediaType, u64 titleId) {
+#define POPULATE_TITLES_WORKERS 3
+#define POPULATE_TITLES_INFO_BATCH 64
+
+#define TITLE_SNAPSHOT_PATH "/fbi/cache/titles.bin"
+#define TITLE_SNAPSHOT_MAGIC 0x53544246 // "FBTS"
+#define TITLE_SNAPSHOT_VERSION 2
+
+#define TITLE_ICONS_PATH "/fbi/cache/titleicons.bin"
+#define TITLE_ICON_SIZE 0x1200
+#define TITLE_ICONS_COMPACT_MIN (64 * TITLE_ICON_SIZE)
+
+typedef struct {
+    u64 titleId;
+    u64 installedSize;
+    u32 mediaType;
+    u16 version;
+    u8 hasMeta;
+    char productCode[0x10];
+    char shortDescription[0x100];
+    char longDescription[0x200];
+    char publisher[0x100];
+    u32 region;
+    u32 iconOffset;
+} title_snapshot_entry;
+
+typedef struct {
+    u32 magic;
+    u32 version;
+    u32 entrySize;
+    u32 language;
+    u32 count;
+} title_snapshot_header;
+
+static int task_populate_titles_compare_ids(const void* e1, const void* e2) {
+    u64 id1 = *(u64*) e1;
+    u64 id2 = *(u64*) e2;
+
+    return id1 > id2 ? 1 : id1 < id2 ? -1 : 0;
+}
+
+// CTR title details as of the last populate, sorted by media type and title ID. Icons are kept
+// in a separate file and read as titles are added, so only one populate's worth of details is
+// ever in memory. Only the title populate thread loads and frees these, and only one populate
+// runs at a time.
+static title_snapshot_entry* titleSnapshot = NULL;
+static u32 titleSnapshotCount = 0;
+static bool titleSnapshotDirty = false;
+
+static FS_Archive titleSnapshotArchive = 0;
+static Handle titleIconsHandle = 0;
+static u32 titleIconsSize = 0;
+
+static int task_populate_titles_compare_snapshot(const void* e1, const void* e2) {
+    title_snapshot_entry* entry1 = (title_snapshot_entry*) e1;
+    title_snapshot_entry* entry2 = (title_snapshot_entry*) e2;
+
+    if(entry1->mediaType != entry2->mediaType) {
+        return entry1->mediaType > entry2->mediaType ? 1 : -1;
+    }
+
+    return entry1->titleId > entry2->titleId ? 1 : entry1->titleId < entry2->titleId ? -1 : 0;
+}
+
+static int task_populate_titles_compare_icon_offsets(const void* e1, const void* e2) {
+    title_snapshot_entry* entry1 = (title_snapshot_entry*) e1;
+    title_snapshot_entry* entry2 = (title_snapshot_entry*) e2;
+
+    return entry1->iconOffset > entry2->iconOffset ? 1 : entry1->iconOffset < entry2->iconOffset ? -1 : 0;
+}
+
+static title_snapshot_entry* task_populate_titles_find_snapshot(FS_MediaType mediaType, u64 titleId) {
+    if(titleSnapshot == NULL) {
+        return NULL;
+    }
+
+    title_snapshot_entry key;
+    key.mediaType = mediaType;
+    key.titleId = titleId;
+
+    return (title_snapshot_entry*) bsearch(&key, titleSnapshot, titleSnapshotCount, sizeof(title_snapshot_entry), task_populate_titles_compare_snapshot);
+}
+
+static void task_populate_titles_free_snapshot() {
+    if(titleIconsHandle != 0) {
+        FSFILE_Close(titleIconsHandle);
+        titleIconsHandle = 0;
+    }
+
+    if(titleSnapshotArchive != 0) {
+        FSUSER_CloseArchive(titleSnapshotArchive);
+        titleSnapshotArchive = 0;
+    }
+
+    if(titleSnapshot != NULL) {
+        free(titleSnapshot);
+        titleSnapshot = NULL;
+    }
+
+    titleSnapshotCount = 0;
+    titleSnapshotDirty = false;
+    titleIconsSize = 0;
+}
+
+static void task_populate_titles_load_snapshot() {
+    u8 language = 0;
+    if(R_FAILED(CFGU_GetSystemLanguage(&language))
+       || R_FAILED(FSUSER_OpenArchive(&titleSnapshotArchive, ARCHIVE_SDMC, fsMakePath(PATH_EMPTY, "")))) {
+        titleSnapshotArchive = 0;
+        return;
+    }
+
+    Handle fileHandle = 0;
+    if(R_SUCCEEDED(FSUSER_OpenFile(&fileHandle, titleSnapshotArchive, fsMakePath(PATH_ASCII, TITLE_SNAPSHOT_PATH), FS_OPEN_READ, 0))) {
+        u32 bytesRead = 0;
+
+        title_snapshot_header header;
+        if(R_SUCCEEDED(FSFILE_Read(fileHandle, &bytesRead, 0, &header, sizeof(header))) && bytesRead == sizeof(header)
+           && header.magic == TITLE_SNAPSHOT_MAGIC && header.version == TITLE_SNAPSHOT_VERSION && header.entrySize == sizeof(title_snapshot_entry)
+           && header.language == language && header.count > 0) {
+            title_snapshot_entry* entries = (title_snapshot_entry*) calloc(header.count, sizeof(title_snapshot_entry));
+            if(entries != NULL) {
+                u32 size = header.count * sizeof(title_snapshot_entry);
+                if(R_SUCCEEDED(FSFILE_Read(fileHandle, &bytesRead, sizeof(header), entries, size)) && bytesRead == size) {
+                    titleSnapshot = entries;
+                    titleSnapshotCount = header.count;
+                } else {
+                    free(entries);
+                }
+            }
+        }
+
+        FSFILE_Close(fileHandle);
+    }
+
+    if(R_FAILED(fs_ensure_dir(titleSnapshotArchive, "/fbi/")) || R_FAILED(fs_ensure_dir(titleSnapshotArchive, "/fbi/cache/"))
+       || R_FAILED(FSUSER_OpenFile(&titleIconsHandle, titleSnapshotArchive, fsMakePath(PATH_ASCII, TITLE_ICONS_PATH), FS_OPEN_READ | FS_OPEN_WRITE | FS_OPEN_CREATE, 0))) {
+        titleIconsHandle = 0;
+    } else {
+        // Without a snapshot nothing points into the icon file, so it starts over.
+        u64 iconsSize = 0;
+        if(titleSnapshot == NULL ? R_SUCCEEDED(FSFILE_SetSize(titleIconsHandle, 0)) : R_SUCCEEDED(FSFILE_GetSize(titleIconsHandle, &iconsSize)) && (u32) iconsSize == iconsSize) {
+            titleIconsSize = (u32) iconsSize;
+        } else {
+            FSFILE_Close(titleIconsHandle);
+            titleIconsHandle = 0;
+        }
+    }
+
+    // Without a place for icons, the snapshot can neither serve titles nor be saved.
+    if(titleIconsHandle == 0) {
+        task_populate_titles_free_snapshot();
+    }
+}
+
+static bool task_populate_titles_read_icon(title_snapshot_entry* entry, u8* icon) {
+    u32 bytesRead = 0;
+    return R_SUCCEEDED(FSFILE_Read(titleIconsHandle, &bytesRead, entry->iconOffset, icon, TITLE_ICON_SIZE)) && bytesRead == TITLE_ICON_SIZE;
+}
+
+// Appends an icon to the icon file. Callers hold the batch mutex.
+static bool task_populate_titles_write_icon(title_snapshot_entry* entry, const u8* icon) {
+    u32 bytesWritten = 0;
+    if(R_FAILED(FSFILE_Write(titleIconsHandle, &bytesWritten, titleIconsSize, icon, TITLE_ICON_SIZE, 0)) || bytesWritten != TITLE_ICON_SIZE) {
+        return false;
+    }
+
+    entry->iconOffset = titleIconsSize;
+    titleIconsSize += TITLE_ICON_SIZE;
+    return true;
+}
+
+// Icons of removed or updated titles are left behind in the icon file. Once they outnumber the
+// live ones, live icons are moved down over them in file order, so none is overwritten before
+// it has been moved.
+static bool task_populate_titles_compact_icons() {
+    u32 liveSize = 0;
+    for(u32 i = 0; i < titleSnapshotCount; i++) {
+        if(titleSnapshot[i].hasMeta) {
+            liveSize += TITLE_ICON_SIZE;
+        }
+    }
+
+    if(titleIconsSize < TITLE_ICONS_COMPACT_MIN || titleIconsSize - liveSize <= liveSize) {
+        return true;
+    }
+
+    // A snapshot left behind by an interrupted compaction would point at moved icons.
+    FSUSER_DeleteFile(titleSnapshotArchive, fsMakePath(PATH_ASCII, TITLE_SNAPSHOT_PATH));
+
+    qsort(titleSnapshot, titleSnapshotCount, sizeof(title_snapshot_entry), task_populate_titles_compare_icon_offsets);
+
+    bool compacted = true;
+
+    u8 icon[TITLE_ICON_SIZE];
+    u32 size = 0;
+    for(u32 i = 0; i < titleSnapshotCount && compacted; i++) {
+        title_snapshot_entry* entry = &titleSnapshot[i];
+        if(!entry->hasMeta) {
+            continue;
+        }
+
+        if(entry->iconOffset != size) {
+            u32 bytesRead = 0;
+            u32 bytesWritten = 0;
+            compacted = R_SUCCEEDED(FSFILE_Read(titleIconsHandle, &bytesRead, entry->iconOffset, icon, TITLE_ICON_SIZE)) && bytesRead == TITLE_ICON_SIZE
+                        && R_SUCCEEDED(FSFILE_Write(titleIconsHandle, &bytesWritten, size, icon, TITLE_ICON_SIZE, 0)) && bytesWritten == TITLE_ICON_SIZE;
+
+            entry->iconOffset = size;
+        }
+
+        size += TITLE_ICON_SIZE;
+    }
+
+    qsort(titleSnapshot, titleSnapshotCount, sizeof(title_snapshot_entry), task_populate_titles_compare_snapshot);
+
+    if(!compacted || R_FAILED(FSFILE_SetSize(titleIconsHandle, size))) {
+        FSFILE_SetSize(titleIconsHandle, 0);
+        return false;
+    }
+
+    titleIconsSize = size;
+    return true;
+}
+
+static void task_populate_titles_save_snapshot() {
+    if(!titleSnapshotDirty || titleIconsHandle == 0 || !task_populate_titles_compact_icons()) {
+        return;
+    }
+
+    title_snapshot_header header;
+    header.magic = TITLE_SNAPSHOT_MAGIC;
+    header.version = TITLE_SNAPSHOT_VERSION;
+    header.entrySize = sizeof(title_snapshot_entry);
+    header.count = titleSnapshotCount;
+
+    u8 language = 0;
+    if(R_FAILED(CFGU_GetSystemLanguage(&language))) {
+        return;
+    }
+
+    header.language = language;
+
+    // Icons must be on the card before the entries pointing at them.
+    if(R_FAILED(FSFILE_Flush(titleIconsHandle))) {
+        return;
+    }
+
+    Handle fileHandle = 0;
+    if(R_SUCCEEDED(FSUSER_OpenFile(&fileHandle, titleSnapshotArchive, fsMakePath(PATH_ASCII, TITLE_SNAPSHOT_PATH), FS_OPEN_WRITE | FS_OPEN_CREATE, 0))) {
+        u32 bytesWritten = 0;
+        u32 size = titleSnapshotCount * sizeof(title_snapshot_entry);
+
+        if(R_FAILED(FSFILE_SetSize(fileHandle, sizeof(header) + size))
+           || R_FAILED(FSFILE_Write(fileHandle, &bytesWritten, 0, &header, sizeof(header), 0))
+           || (size > 0 && R_FAILED(FSFILE_Write(fileHandle, &bytesWritten, sizeof(header), titleSnapshot, size, FS_WRITE_FLUSH | FS_WRITE_UPDATE_TIME)))) {
+            // Leave nothing that could pass for a valid snapshot.
+            FSFILE_SetSize(fileHandle, 0);
+        }
+
+        FSFILE_Close(fileHandle);
+    }
+}
+
+// Drops snapshot entries for titles of the given media type that are no longer installed.
+static void task_populate_titles_prune_snapshot(FS_MediaType mediaType, u64* titleIds, u32 titleCount) {
+    u32 kept = 0;
+    for(u32 i = 0; i < titleSnapshotCount; i++) {
+        title_snapshot_entry* entry = &titleSnapshot[i];
+        if(entry->mediaType != mediaType || bsearch(&entry->titleId, titleIds, titleCount, sizeof(u64), task_populate_titles_compare_ids) != NULL) {
+            if(kept != i) {
+                memcpy(&titleSnapshot[kept], entry, sizeof(title_snapshot_entry));
+            }
+
+            kept++;
+        }
+    }
+
+    if(kept != titleSnapshotCount) {
+        titleSnapshotCount = kept;
+        titleSnapshotDirty = true;
+    }
+}
+
+typedef struct {
+    populate_titles_data* data;
+    FS_MediaType mediaType;
+
+    u64* titleIds;
+    AM_TitleEntry* entries;
+    Result* entryResults;
+    u32 count;
+
+    // Details of titles that were not in the snapshot, allocated as they are fetched.
+    title_snapshot_entry** fetched;
+
+    Handle mutex;
+    u32 next;
+    bool quit;
+    Result result;
+} populate_titles_ctr_batch;
+
+// Merges titles fetched by this batch into the snapshot, replacing stale entries.
+static void task_populate_titles_update_snapshot(populate_titles_ctr_batch* batch) {
+    u32 added = 0;
+    for(u32 i = 0; i < batch->count; i++) {
+        if(batch->fetched[i] != NULL && task_populate_titles_find_snapshot(batch->mediaType, batch->fetched[i]->titleId) == NULL) {
+            added++;
+        }
+    }
+
+    if(added > 0) {
+        title_snapshot_entry* entries = (title_snapshot_entry*) realloc(titleSnapshot, (titleSnapshotCount + added) * sizeof(title_snapshot_entry));
+        if(entries == NULL) {
+            return;
+        }
+
+        titleSnapshot = entries;
+    }
+
+    u32 count = titleSnapshotCount;
+    for(u32 i = 0; i < batch->count; i++) {
+        if(batch->fetched[i] != NULL) {
+            title_snapshot_entry* existing = task_populate_titles_find_snapshot(batch->mediaType, batch->fetched[i]->titleId);
+            memcpy(existing != NULL ? existing : &titleSnapshot[count++], batch->fetched[i], sizeof(title_snapshot_entry));
+
+            titleSnapshotDirty = true;
+        }
+    }
+
+    // Lookups above only cover the sorted prefix; new entries are appended past it.
+    titleSnapshotCount = count;
+    qsort(titleSnapshot, titleSnapshotCount, sizeof(title_snapshot_entry), task_populate_titles_compare_snapshot);
+}
+
+static void task_populate_titles_read_ctr(FS_MediaType mediaType, AM_TitleEntry* entry, title_snapshot_entry* out, u8* icon) {
+    u64 titleId = entry->titleID;
+
+    memset(out, 0, sizeof(title_snapshot_entry));
+    out->titleId = titleId;
+    out->installedSize = entry->size;
+    out->mediaType = mediaType;
+    out->version = entry->version;
+    out->hasMeta = false;
+
+    AM_GetTitleProductCode(mediaType, titleId, out->productCode);
+
+    static const u32 filePath[5] = {0x00000000, 0x00000000, 0x00000002, 0x6E6F6369, 0x00000000};
+    u32 archivePath[4] = {(u32) (titleId & 0xFFFFFFFF), (u32) ((titleId >> 32) & 0xFFFFFFFF), mediaType, 0x00000000};
+
+    Handle fileHandle;
+    if(R_SUCCEEDED(FSUSER_OpenFileDirectly(&fileHandle, ARCHIVE_SAVEDATA_AND_CONTENT,
+                                           fs_make_path_binary(archivePath, sizeof(archivePath)),
+                                           fs_make_path_binary(filePath, sizeof(filePath)), FS_OPEN_READ, 0))) {
+        SMDH* smdh = (SMDH*) calloc(1, sizeof(SMDH));
+        if(smdh != NULL) {
+            u32 bytesRead = 0;
+            if(R_SUCCEEDED(FSFILE_Read(fileHandle, &bytesRead, 0, smdh, sizeof(SMDH))) && bytesRead == sizeof(SMDH)) {
+                if(smdh->magic[0] == 'S' && smdh->magic[1] == 'M' && smdh->magic[2] == 'D' && smdh->magic[3] == 'H') {
+                    out->hasMeta = true;
+
+                    SMDH_title* smdhTitle = smdh_select_title(smdh);
+
+                    utf16_to_utf8((uint8_t*) out->shortDescription, smdhTitle->shortDescription, sizeof(out->shortDescription) - 1);
+                    utf16_to_utf8((uint8_t*) out->longDescription, smdhTitle->longDescription, sizeof(out->longDescription) - 1);
+                    utf16_to_utf8((uint8_t*) out->publisher, smdhTitle->publisher, sizeof(out->publisher) - 1);
+                    out->region = smdh->region;
+                    memcpy(icon, smdh->largeIcon, TITLE_ICON_SIZE);
+                }
+            }
+
+            free(smdh);
+        }
+
+        FSFILE_Close(fileHandle);
+    }
+}
+
+static Result task_populate_titles_add_ctr(populate_titles_ctr_batch* batch, title_snapshot_entry* entry, const u8* icon) {
     Result res = 0;
 
-    AM_TitleEntry entry;
-    if(R_SUCCEEDED(res = AM_GetTitleInfo(mediaType, 1, &titleId, &entry))) {
-        list_item* item = (list_item*) calloc(1, sizeof(list_item));
-        if(item != NULL) {
-            title_info* titleInfo = (title_info*) calloc(1, sizeof(title_info));
-            if(titleInfo != NULL) {
-                titleInfo->mediaType = mediaType;
-                titleInfo->titleId = titleId;
-                AM_GetTitleProductCode(mediaType, titleId, titleInfo->productCode);
-                titleInfo->version = entry.version;
-                titleInfo->installedSize = entry.size;
-                titleInfo->twl = false;
-                titleInfo->hasMeta = false;
+    list_item* item = (list_item*) calloc(1, sizeof(list_item));
+    if(item != NULL) {
+        title_info* titleInfo = (title_info*) calloc(1, sizeof(title_info));
+        if(titleInfo != NULL) {
+            titleInfo->mediaType = (FS_MediaType) entry->mediaType;
+            titleInfo->titleId = entry->titleId;
+            string_copy(titleInfo->productCode, entry->productCode, sizeof(titleInfo->productCode));
+            titleInfo->version = entry->version;
+            titleInfo->installedSize = entry->installedSize;
+            titleInfo->twl = false;
+            titleInfo->hasMeta = entry->hasMeta;
+
+            if(titleInfo->hasMeta) {
+                string_copy(item->name, entry->shortDescription, LIST_ITEM_NAME_MAX);
+
+                string_copy(titleInfo->meta.shortDescription, entry->shortDescription, sizeof(titleInfo->meta.shortDescription));
+                string_copy(titleInfo->meta.longDescription, entry->longDescription, sizeof(titleInfo->meta.longDescription));
+                string_copy(titleInfo->meta.publisher, entry->publisher, sizeof(titleInfo->meta.publisher));
+                titleInfo->meta.region = entry->region;
+            }
 
-                static const u32 filePath[5] = {0x00000000, 0x00000000, 0x00000002, 0x6E6F6369, 0x00000000};
-                u32 archivePath[4] = {(u32) (titleId & 0xFFFFFFFF), (u32) ((titleId >> 32) & 0xFFFFFFFF), mediaType, 0x00000000};
-
-                Handle fileHandle;
-                if(R_SUCCEEDED(FSUSER_OpenFileDirectly(&fileHandle, ARCHIVE_SAVEDATA_AND_CONTENT,
-                                                       fs_make_path_binary(archivePath, sizeof(archivePath)),
-                                                       fs_make_path_binary(filePath, sizeof(filePath)), FS_OPEN_READ, 0))) {
-                    SMDH* smdh = (SMDH*) calloc(1, sizeof(SMDH));
-                    if(smdh != NULL) {
-                        u32 bytesRead = 0;
-                        if(R_SUCCEEDED(FSFILE_Read(fileHandle, &bytesRead, 0, smdh, sizeof(SMDH))) && bytesRead == sizeof(SMDH)) {
-                            if(smdh->magic[0] == 'S' && smdh->magic[1] == 'M' && smdh->magic[2] == 'D' && smdh->magic[3] == 'H') {
-                                titleInfo->hasMeta = true;
-
-                                SMDH_title* smdhTitle = smdh_select_title(smdh);
-
-                                utf16_to_utf8((uint8_t*) item->name, smdhTitle->shortDescription, LIST_ITEM_NAME_MAX - 1);
-
-                                utf16_to_utf8((uint8_t*) titleInfo->meta.shortDescription, smdhTitle->shortDescription, sizeof(titleInfo->meta.shortDescription) - 1);
-                                utf16_to_utf8((uint8_t*) titleInfo->meta.longDescription, smdhTitle->longDescription, sizeof(titleInfo->meta.longDescription) - 1);
-                                utf16_to_utf8((uint8_t*) titleInfo->meta.publisher, smdhTitle->publisher, sizeof(titleInfo->meta.publisher) - 1);
-                                titleInfo->meta.region = smdh->region;
-                                titleInfo->meta.texture = screen_allocate_free_texture();
-                                screen_load_texture_tiled(titleInfo->meta.texture, smdh->largeIcon, sizeof(smdh->largeIcon), 48, 48, GPU_RGB565, false);
-                            }
+            if(string_is_empty(item->name)) {
+                snprintf(item->name, LIST_ITEM_NAME_MAX, "%016llX", entry->titleId);
+            }
+
+            if(titleInfo->mediaType == MEDIATYPE_NAND) {
+                item->color = COLOR_NAND;
+            } else if(titleInfo->mediaType == MEDIATYPE_SD) {
+                item->color = COLOR_SD;
+            } else if(titleInfo->mediaType == MEDIATYPE_GAME_CARD) {
+                item->color = COLOR_GAME_CARD;
+            }
+
+            item->data = titleInfo;
+
+            // Texture slots and the item list are shared between workers.
+            svcWaitSynchronization(batch->mutex, U64_MAX);
+
+            if(titleInfo->hasMeta) {
+                titleInfo->meta.texture = screen_allocate_free_texture();
+                screen_load_texture_atlas(titleInfo->meta.texture, (void*) icon, TITLE_ICON_SIZE, 48, 48, GPU_RGB565);
+            }
+
+            array_list_add_sorted(batch->data->items, item, batch->data->userData, batch->data->compare);
+
+            svcReleaseMutex(batch->mutex);
+        } else {
+            free(item);
+
+            res = R_APP_OUT_OF_MEMORY;
+        }
+    } else {
+        res = R_APP_OUT_OF_MEMORY;
+    }
+
+    return res;
+}
+
+static void task_populate_titles_ctr_worker(void* arg) {
+    populate_titles_ctr_batch* batch = (populate_titles_ctr_batch*) arg;
+
+    while(true) {
+        svcWaitSynchronization(task_get_pause_event(), U64_MAX);
+
+        svcWaitSynchronization(batch->mutex, U64_MAX);
+
+        if(task_is_quit_all() || svcWaitSynchronization(batch->data->cancelEvent, 0) == 0) {
+            batch->quit = true;
+        }
+
+        u32 index = batch->next;
+        bool done = batch->quit || R_FAILED(batch->result) || index >= batch->count;
+        if(!done) {
+            batch->next++;
+        }
+
+        svcReleaseMutex(batch->mutex);
+
+        if(done) {
+            break;
+        }
+
+        Result res = batch->entryResults[index];
+        if(R_SUCCEEDED(res)) {
+            AM_TitleEntry* entry = &batch->entries[index];
+
+            u8 icon[TITLE_ICON_SIZE];
+
+            // Unchanged titles are served from the snapshot; only new or updated ones hit AM and FS.
+            title_snapshot_entry* cached = task_populate_titles_find_snapshot(batch->mediaType, entry->titleID);
+            if(cached != NULL && cached->version == entry->version && cached->installedSize == entry->size
+               && (!cached->hasMeta || task_populate_titles_read_icon(cached, icon))) {
+                res = task_populate_titles_add_ctr(batch, cached, icon);
+            } else {
+                title_snapshot_entry* fetched = (title_snapshot_entry*) malloc(sizeof(title_snapshot_entry));
+                if(fetched != NULL) {
+                    task_populate_titles_read_ctr(batch->mediaType, entry, fetched, icon);
+                    if(R_SUCCEEDED(res = task_populate_titles_add_ctr(batch, fetched, icon)) && titleIconsHandle != 0) {
+                        svcWaitSynchronization(batch->mutex, U64_MAX);
+
+                        if(!fetched->hasMeta || task_populate_titles_write_icon(fetched, icon)) {
+                            batch->fetched[index] = fetched;
+                            fetched = NULL;
                         }
 
-                        free(smdh);
+                        svcReleaseMutex(batch->mutex);
                     }
 
-                    FSFILE_Close(fileHandle);
+                    if(fetched != NULL) {
+                        free(fetched);
+                    }
+                } else {
+                    res = R_APP_OUT_OF_MEMORY;
                 }
+            }
+        }
 
-                if(string_is_empty(item->name)) {
-                    snprintf(item->name, LIST_ITEM_NAME_MAX, "%016llX", titleId);
-                }
+        if(R_FAILED(res)) {
+            svcWaitSynchronization(batch->mutex, U64_MAX);
 
-                if(mediaType == MEDIATYPE_NAND) {
-                    item->color = COLOR_NAND;
-                } else if(mediaType == MEDIATYPE_SD) {
-                    item->color = COLOR_SD;
-                } else if(mediaType == MEDIATYPE_GAME_CARD) {
-                    item->color = COLOR_GAME_CARD;
-                }
+            if(R_SUCCEEDED(batch->result)) {
+                batch->result = res;
+            }
 
-                item->data = titleInfo;
+            svcReleaseMutex(batch->mutex);
+        }
+    }
+}
+
+// Title entries are fetched in batches; a batch that fails as a whole (e.g. a title was
+// removed in the meantime) is retried one title at a time to find the failing entries.
+static void task_populate_titles_get_info(populate_titles_ctr_batch* batch) {
+    for(u32 i = 0; i < batch->count; i += POPULATE_TITLES_INFO_BATCH) {
+        u32 count = batch->count - i < POPULATE_TITLES_INFO_BATCH ? batch->count - i : POPULATE_TITLES_INFO_BATCH;
 
-                linked_list_add_sorted(data->items, item, data->userData, data->compare);
+        Result res = AM_GetTitleInfo(batch->mediaType, count, &batch->titleIds[i], &batch->entries[i]);
+        for(u32 j = i; j < i + count; j++) {
+            if(R_SUCCEEDED(res)) {
+                batch->entryResults[j] = res;
             } else {
-                free(item);
+                batch->entryResults[j] = AM_GetTitleInfo(batch->mediaType, 1, &batch->titleIds[j], &batch->entries[j]);
+            }
+        }
+    }
+}
 
-                res = R_APP_OUT_OF_MEMORY;
+static Result task_populate_titles_add_ctrs(populate_titles_data* data, FS_MediaType mediaType, u64* titleIds, u32 count) {
+    if(count == 0) {
+        return 0;
+    }
+
+    populate_titles_ctr_batch batch;
+    memset(&batch, 0, sizeof(batch));
+
+    batch.data = data;
+    batch.mediaType = mediaType;
+    batch.titleIds = titleIds;
+    batch.count = count;
+
+    Result res = 0;
+
+    batch.entries = (AM_TitleEntry*) calloc(count, sizeof(AM_TitleEntry));
+    batch.entryResults = (Result*) calloc(count, sizeof(Result));
+    batch.fetched = (title_snapshot_entry**) calloc(count, sizeof(title_snapshot_entry*));
+    if(batch.entries != NULL && batch.entryResults != NULL && batch.fetched != NULL) {
+        if(R_SUCCEEDED(res = svcCreateMutex(&batch.mutex, false))) {
+            task_populate_titles_get_info(&batch);
+
+            // SMDH reads are mostly spent waiting on FS, so spread them over a few threads.
+            // The populating thread acts as the first worker.
+            Thread threads[POPULATE_TITLES_WORKERS] = {NULL};
+            for(u32 i = 1; i < POPULATE_TITLES_WORKERS && i < count; i++) {
+                threads[i] = threadCreate(task_populate_titles_ctr_worker, &batch, 0x10000, 0x19, 1, false);
             }
-        } else {
-            res = R_APP_OUT_OF_MEMORY;
+
+            task_populate_titles_ctr_worker(&batch);
+
+            for(u32 i = 1; i < POPULATE_TITLES_WORKERS; i++) {
+                if(threads[i] != NULL) {
+                    threadJoin(threads[i], U64_MAX);
+                    threadFree(threads[i]);
+                }
+            }
+
+            res = batch.result;
+
+            task_populate_titles_update_snapshot(&batch);
+
+            svcCloseHandle(batch.mutex);
         }
+    } else {
+        res = R_APP_OUT_OF_MEMORY;
+    }
+
+    if(batch.entries != NULL) {
+        free(batch.entries);
+    }
+
+    if(batch.entryResults != NULL) {
+        free(batch.entryResults);
+    }
+
+    if(batch.fetched != NULL) {
+        for(u32 i = 0; i < count; i++) {
+            if(batch.fetched[i] != NULL) {
+                free(batch.fetched[i]);
+            }
+        }
+
+        free(batch.fetched);
     }
 
     return res;
@@ -209,7 +726,7 @@ static Result task_populate_titles_add_twl(populate_titles_data* data, FS_MediaT
                 item->color = COLOR_DS_TITLE;
                 item->data = titleInfo;
 
-                linked_list_add_sorted(data->items, item, data->userData, data->compare);
+                array_list_add_sorted(data->items, item, data->userData, data->compare);
             } else {
                 free(item);
 
@@ -223,13 +740,6 @@ static Result task_populate_titles_add_twl(populate_titles_data* data, FS_MediaT
     return res;
 }
 
-static int task_populate_titles_compare_ids(const void* e1, const void* e2) {
-    u64 id1 = *(u64*) e1;
-    u64 id2 = *(u64*) e2;
-
-    return id1 > id2 ? 1 : id1 < id2 ? -1 : 0;
-}
-
 static Result task_populate_titles_from(populate_titles_data* data, FS_MediaType mediaType, bool useDSiWare) {
     bool inserted;
     FS_CardType type;
@@ -247,20 +757,27 @@ static Result task_populate_titles_from(populate_titles_data* data, FS_MediaType
                 if(R_SUCCEEDED(res = AM_GetTitleList(&titleCount, mediaType, titleCount, titleIds))) {
                     qsort(titleIds, titleCount, sizeof(u64), task_populate_titles_compare_ids);
 
-                    for(u32 i = 0; i < titleCount && R_SUCCEEDED(res); i++) {
-                        svcWaitSynchronization(task_get_pause_event(), U64_MAX);
-                        if(task_is_quit_all() || svcWaitSynchronization(data->cancelEvent, 0) == 0) {
-                            break;
+                    task_populate_titles_prune_snapshot(mediaType, titleIds, titleCount);
+
+                    u32 count = 0;
+                    for(u32 i = 0; i < titleCount; i++) {
+                        bool dsiWare = ((titleIds[i] >> 32) & 0x8000) != 0;
+                        if(dsiWare == useDSiWare && (data->filter == NULL || data->filter(data->userData, titleIds[i], mediaType))) {
+                            titleIds[count++] = titleIds[i];
                         }
+                    }
 
-                        if(data->filter == NULL || data->filter(data->userData, titleIds[i], mediaType)) {
-                            bool dsiWare = ((titleIds[i] >> 32) & 0x8000) != 0;
-                            if(dsiWare != useDSiWare) {
-                                continue;
+                    if(useDSiWare) {
+                        for(u32 i = 0; i < count && R_SUCCEEDED(res); i++) {
+                            svcWaitSynchronization(task_get_pause_event(), U64_MAX);
+                            if(task_is_quit_all() || svcWaitSynchronization(data->cancelEvent, 0) == 0) {
+                                break;
                             }
 
-                            res = dsiWare ? task_populate_titles_add_twl(data, mediaType, titleIds[i]) : task_populate_titles_add_ctr(data, mediaType, titleIds[i]);
+                            res = task_populate_titles_add_twl(data, mediaType, titleIds[i]);
                         }
+                    } else {
+                        res = task_populate_titles_add_ctrs(data, mediaType, titleIds, count);
                     }
                 }
 
@@ -281,6 +798,8 @@ static void task_populate_titles_thread(void* arg) {
 
     Result res = 0;
 
+    task_populate_titles_load_snapshot();
+
     if(R_SUCCEEDED(res = task_populate_titles_from(data, MEDIATYPE_GAME_CARD, false))) {
         if(R_SUCCEEDED(res = task_populate_titles_from(data, MEDIATYPE_SD, false))) {
             if(R_SUCCEEDED(res = task_populate_titles_from(data, MEDIATYPE_NAND, false))) {
@@ -289,6 +808,9 @@ static void task_populate_titles_thread(void* arg) {
         }
     }
 
+    task_populate_titles_save_snapshot();
+    task_populate_titles_free_snapshot();
+
     svcCloseHandle(data->cancelEvent);
 
     data->result = res;
@@ -312,18 +834,18 @@ void task_free_title(list_item* item) {
     free(item);
 }
 
-void task_clear_titles(linked_list* items) {
+void task_clear_titles(array_list* items) {
     if(items == NULL) {
         return;
     }
 
-    linked_list_iter iter;
-    linked_list_iterate(items, &iter);
+    array_list_iter iter;
+    array_list_iterate(items, &iter);
 
-    while(linked_list_iter_has_next(&iter)) {
-        list_item* item = (list_item*) linked_list_iter_next(&iter);
+    while(array_list_iter_has_next(&iter)) {
+        list_item* item = (list_item*) array_list_iter_next(&iter);
 
-        linked_list_iter_remove(&iter);
+        array_list_iter_remove(&iter);
         task_free_title(item);
     }
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-typedef struct linked_list_s linked_list;
+typedef struct array_list_s array_list;
 typedef struct list_item_s list_item;
 
 typedef struct title_info_s {
@@ -15,7 +15,7 @@ typedef struct title_info_s {
 } title_info;
 
 typedef struct populate_titles_data_s {
-    linked_list* items;
+    array_list* items;
 
     void* userData;
     bool (*filter)(void* data, u64 titleId, FS_MediaType mediaType);
@@ -27,5 +27,5 @@ typedef struct populate_titles_data_s {
 } populate_titles_data;
 
 void task_free_title(list_item* item);
-void task_clear_titles(linked_list* items);
+void task_clear_titles(array_list* items);
 Result task_populate_titles(populate_titles_data* data);
\ No newline at end of file
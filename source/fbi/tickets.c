@@ -19,7 +19,7 @@ typedef struct {
 } tickets_data;
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
 } tickets_action_data;
 
@@ -27,7 +27,7 @@ static void tickets_action_draw_top(ui_view* view, void* data, float x1, float y
     task_draw_ticket_info(view, ((tickets_action_data*) data)->selected->data, x1, y1, x2, y2);
 }
 
-static void tickets_action_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void tickets_action_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     tickets_action_data* actionData = (tickets_action_data*) data;
 
     if(hidKeysDown() & KEY_B) {
@@ -40,7 +40,7 @@ static void tickets_action_update(ui_view* view, void* data, linked_list* items,
     }
 
     if(selected != NULL && selected->data != NULL && (selectedTouched || (hidKeysDown() & KEY_A))) {
-        void(*action)(linked_list*, list_item*) = (void(*)(linked_list*, list_item*)) selected->data;
+        void(*action)(array_list*, list_item*) = (void(*)(array_list*, list_item*)) selected->data;
 
         ui_pop();
         list_destroy(view);
@@ -52,13 +52,13 @@ static void tickets_action_update(ui_view* view, void* data, linked_list* items,
         return;
     }
 
-    if(linked_list_size(items) == 0) {
-        linked_list_add(items, &delete_ticket);
-        linked_list_add(items, &delete_unused_tickets);
+    if(array_list_size(items) == 0) {
+        array_list_add(items, &delete_ticket);
+        array_list_add(items, &delete_unused_tickets);
     }
 }
 
-static void tickets_action_open(linked_list* items, list_item* selected) {
+static void tickets_action_open(array_list* items, list_item* selected) {
     tickets_action_data* data = (tickets_action_data*) calloc(1, sizeof(tickets_action_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate tickets action data.");
@@ -78,7 +78,7 @@ static void tickets_draw_top(ui_view* view, void* data, float x1, float y1, floa
     }
 }
 
-static void tickets_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void tickets_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     tickets_data* listData = (tickets_data*) data;
 
     if(hidKeysDown() & KEY_B) {
@@ -34,10 +34,11 @@ typedef struct {
     bool sortBySize;
 
     bool populated;
+    bool sorted;
 } titles_data;
 
 typedef struct {
-    linked_list* items;
+    array_list* items;
     list_item* selected;
 } titles_action_data;
 
@@ -45,7 +46,7 @@ static void titles_action_draw_top(ui_view* view, void* data, float x1, float y1
     task_draw_title_info(view, ((titles_action_data*) data)->selected->data, x1, y1, x2, y2);
 }
 
-static void titles_action_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void titles_action_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     titles_action_data* actionData = (titles_action_data*) data;
 
     if(hidKeysDown() & KEY_B) {
@@ -58,7 +59,7 @@ static void titles_action_update(ui_view* view, void* data, linked_list* items,
     }
 
     if(selected != NULL && selected->data != NULL && (selectedTouched || (hidKeysDown() & KEY_A))) {
-        void(*action)(linked_list*, list_item*) = (void(*)(linked_list*, list_item*)) selected->data;
+        void(*action)(array_list*, list_item*) = (void(*)(array_list*, list_item*)) selected->data;
 
         ui_pop();
         list_destroy(view);
@@ -70,39 +71,39 @@ static void titles_action_update(ui_view* view, void* data, linked_list* items,
         return;
     }
 
-    if(linked_list_size(items) == 0) {
-        linked_list_add(items, &launch_title);
+    if(array_list_size(items) == 0) {
+        array_list_add(items, &launch_title);
 
         title_info* info = (title_info*) actionData->selected->data;
 
         if(info->mediaType != MEDIATYPE_GAME_CARD) {
-            linked_list_add(items, &delete_title);
-            linked_list_add(items, &delete_title_ticket);
+            array_list_add(items, &delete_title);
+            array_list_add(items, &delete_title_ticket);
         }
 
         if(!info->twl) {
-            linked_list_add(items, &extract_smdh);
+            array_list_add(items, &extract_smdh);
 
             if(info->mediaType != MEDIATYPE_GAME_CARD) {
-                linked_list_add(items, &import_seed);
+                array_list_add(items, &import_seed);
             }
 
-            linked_list_add(items, &browse_save_data);
+            array_list_add(items, &browse_save_data);
 
             if(info->mediaType != MEDIATYPE_GAME_CARD) {
-                linked_list_add(items, &import_secure_value);
-                linked_list_add(items, &export_secure_value);
-                linked_list_add(items, &delete_secure_value);
+                array_list_add(items, &import_secure_value);
+                array_list_add(items, &export_secure_value);
+                array_list_add(items, &delete_secure_value);
             }
         } else if(info->mediaType == MEDIATYPE_GAME_CARD) {
-            linked_list_add(items, &import_save_data);
-            linked_list_add(items, &export_save_data);
-            linked_list_add(items, &erase_save_data);
+            array_list_add(items, &import_save_data);
+            array_list_add(items, &export_save_data);
+            array_list_add(items, &erase_save_data);
         }
     }
 }
 
-static void titles_action_open(linked_list* items, list_item* selected) {
+static void titles_action_open(array_list* items, list_item* selected) {
     titles_action_data* data = (titles_action_data*) calloc(1, sizeof(titles_action_data));
     if(data == NULL) {
         error_display(NULL, NULL, "Failed to allocate titles action data.");
@@ -116,27 +117,27 @@ static void titles_action_open(linked_list* items, list_item* selected) {
     list_display("Title Action", "A: Select, B: Return", data, titles_action_update, titles_action_draw_top);
 }
 
-static void titles_options_add_entry(linked_list* items, const char* name, bool* val) {
+static void titles_options_add_entry(array_list* items, const char* name, bool* val) {
     list_item* item = (list_item*) calloc(1, sizeof(list_item));
     if(item != NULL) {
         snprintf(item->name, LIST_ITEM_NAME_MAX, "%s", name);
         item->color = *val ? COLOR_ENABLED : COLOR_DISABLED;
         item->data = val;
 
-        linked_list_add(items, item);
+        array_list_add(items, item);
     }
 }
 
-static void titles_options_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static void titles_options_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     titles_data* listData = (titles_data*) data;
 
     if(hidKeysDown() & KEY_B) {
-        linked_list_iter iter;
-        linked_list_iterate(items, &iter);
+        array_list_iter iter;
+        array_list_iterate(items, &iter);
 
-        while(linked_list_iter_has_next(&iter)) {
-            free(linked_list_iter_next(&iter));
-            linked_list_iter_remove(&iter);
+        while(array_list_iter_has_next(&iter)) {
+            free(array_list_iter_next(&iter));
+            array_list_iter_remove(&iter);
         }
 
         ui_pop();
@@ -161,10 +162,10 @@ static void titles_options_update(ui_view* view, void* data, linked_list* items,
                 listData->sortByName = false;
             }
 
-            linked_list_iter iter;
-            linked_list_iterate(items, &iter);
-            while(linked_list_iter_has_next(&iter)) {
-                list_item* item = (list_item*) linked_list_iter_next(&iter);
+            array_list_iter iter;
+            array_list_iterate(items, &iter);
+            while(array_list_iter_has_next(&iter)) {
+                list_item* item = (list_item*) array_list_iter_next(&iter);
 
                 item->color = *(bool*) item->data ? COLOR_ENABLED : COLOR_DISABLED;
             }
@@ -172,10 +173,14 @@ static void titles_options_update(ui_view* view, void* data, linked_list* items,
             selected->color = *val ? COLOR_ENABLED : COLOR_DISABLED;
         }
 
-        listData->populated = false;
+        if(val == &listData->sortById || val == &listData->sortByName || val == &listData->sortBySize) {
+            listData->sorted = false;
+        } else {
+            listData->populated = false;
+        }
     }
 
-    if(linked_list_size(items) == 0) {
+    if(array_list_size(items) == 0) {
         titles_options_add_entry(items, "Show game card", &listData->showGameCard);
         titles_options_add_entry(items, "Show SD", &listData->showSD);
         titles_options_add_entry(items, "Show NAND", &listData->showNAND);
@@ -195,7 +200,55 @@ static void titles_draw_top(ui_view* view, void* data, float x1, float y1, float
     }
 }
 
-static void titles_update(ui_view* view, void* data, linked_list* items, list_item* selected, bool selectedTouched) {
+static int titles_compare(void* data, const void* p1, const void* p2) {
+    titles_data* listData = (titles_data*) data;
+
+    list_item* info1 = (list_item*) p1;
+    list_item* info2 = (list_item*) p2;
+
+    title_info* title1 = (title_info*) info1->data;
+    title_info* title2 = (title_info*) info2->data;
+
+
+    if(title1->mediaType > title2->mediaType) {
+        return -1;
+    } else if(title1->mediaType < title2->mediaType) {
+        return 1;
+    } else {
+        if(!title1->twl && title2->twl) {
+            return -1;
+        } else if(title1->twl && !title2->twl) {
+            return 1;
+        } else {
+            if(listData->sortById) {
+                u64 id1 = title1->titleId;
+                u64 id2 = title2->titleId;
+
+                return id1 > id2 ? 1 : id1 < id2 ? -1 : 0;
+            } else if(listData->sortByName) {
+                bool title1HasName = title1->hasMeta && !string_is_empty(title1->meta.shortDescription);
+                bool title2HasName = title2->hasMeta && !string_is_empty(title2->meta.shortDescription);
+
+                if(title1HasName && !title2HasName) {
+                    return -1;
+                } else if(!title1HasName && title2HasName) {
+                    return 1;
+                } else {
+                    return strncasecmp(info1->name, info2->name, sizeof(info1->name));
+                }
+            } else if(listData->sortBySize) {
+                u64 size1 = title1->installedSize;
+                u64 size2 = title2->installedSize;
+
+                return size1 > size2 ? -1 : size1 < size2 ? 1 : 0;
+            } else {
+                return 0;
+            }
+        }
+    }
+}
+
+static void titles_update(ui_view* view, void* data, array_list* items, list_item* selected, bool selectedTouched) {
     titles_data* listData = (titles_data*) data;
 
     if(hidKeysDown() & KEY_B) {
@@ -235,6 +288,17 @@ static void titles_update(ui_view* view, void* data, linked_list* items, list_it
         }
 
         listData->populated = true;
+        listData->sorted = true;
+    }
+
+    if(!listData->sorted) {
+        if(listData->populateData.finished) {
+            array_list_sort(items, listData, titles_compare);
+        } else {
+            listData->populated = false;
+        }
+
+        listData->sorted = true;
     }
 
     if(listData->populateData.finished && R_FAILED(listData->populateData.result)) {
@@ -261,54 +325,6 @@ static bool titles_filter(void* data, u64 titleId, FS_MediaType mediaType) {
     }
 }
 
-static int titles_compare(void* data, const void* p1, const void* p2) {
-    titles_data* listData = (titles_data*) data;
-
-    list_item* info1 = (list_item*) p1;
-    list_item* info2 = (list_item*) p2;
-
-    title_info* title1 = (title_info*) info1->data;
-    title_info* title2 = (title_info*) info2->data;
-
-
-    if(title1->mediaType > title2->mediaType) {
-        return -1;
-    } else if(title1->mediaType < title2->mediaType) {
-        return 1;
-    } else {
-        if(!title1->twl && title2->twl) {
-            return -1;
-        } else if(title1->twl && !title2->twl) {
-            return 1;
-        } else {
-            if(listData->sortById) {
-                u64 id1 = title1->titleId;
-                u64 id2 = title2->titleId;
-
-                return id1 > id2 ? 1 : id1 < id2 ? -1 : 0;
-            } else if(listData->sortByName) {
-                bool title1HasName = title1->hasMeta && !string_is_empty(title1->meta.shortDescription);
-                bool title2HasName = title2->hasMeta && !string_is_empty(title2->meta.shortDescription);
-
-                if(title1HasName && !title2HasName) {
-                    return -1;
-                } else if(!title1HasName && title2HasName) {
-                    return 1;
-                } else {
-                    return strncasecmp(info1->name, info2->name, sizeof(info1->name));
-                }
-            } else if(listData->sortBySize) {
-                u64 size1 = title1->installedSize;
-                u64 size2 = title2->installedSize;
-
-                return size1 > size2 ? -1 : size1 < size2 ? 1 : 0;
-            } else {
-                return 0;
-            }
-        }
-    }
-}
-
 void titles_open() {
     titles_data* data = (titles_data*) calloc(1, sizeof(titles_data));
     if(data == NULL) {
@@ -832,6 +832,19 @@ static quirc_decode_error_t decode_eci(struct quirc_data *data,
 	return QUIRC_SUCCESS;
 }
 
+static quirc_decode_error_t decode_structured_append(struct quirc_data *data,
+						     struct datastream *ds)
+{
+	if (bits_remaining(ds) < 16)
+		return QUIRC_ERROR_DATA_UNDERFLOW;
+
+	data->sa_index = take_bits(ds, 4) + 1;
+	data->sa_size = take_bits(ds, 4) + 1;
+	data->sa_parity = take_bits(ds, 8);
+
+	return QUIRC_SUCCESS;
+}
+
 static quirc_decode_error_t decode_payload(struct quirc_data *data,
 					   struct datastream *ds)
 {
@@ -856,6 +869,10 @@ static quirc_decode_error_t decode_payload(struct quirc_data *data,
 			err = decode_kanji(data, ds);
 			break;
 
+		case 3:
+			err = decode_structured_append(data, ds);
+			break;
+
 		case 7:
 			err = decode_eci(data, ds);
 			break;
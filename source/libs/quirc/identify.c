@@ -301,14 +301,40 @@ static void flood_fill_seed(struct quirc *q, int start_x, int start_y, int from,
 #define THRESHOLD_S_DEN		8
 #define THRESHOLD_T		5
 
+/* Division by the filter length, done as a multiply and shift when the
+ * reciprocal is exact for the range of the running averages. The ARM11
+ * has no divide instruction, and this runs twice per pixel.
+ */
+static inline int threshold_div(int n, int d, uint64_t recip)
+{
+	if (recip)
+		return (int)(((uint64_t)n * recip) >> 32);
+
+	return n / d;
+}
+
 static void threshold(struct quirc *q)
 {
 	int x, y;
 	int avg_w = 0;
 	int avg_u = 0;
 	int threshold_s = q->w / THRESHOLD_S_DEN;
+	int threshold_d;
+	uint64_t recip = 0;
 	quirc_pixel_t *row = q->pixels;
 
+	if (threshold_s < 1)
+		threshold_s = 1;
+
+	threshold_d = 200 * threshold_s;
+
+	/* floor(n * (2^32 / s + 1) / 2^32) == n / s for n < 2^32 / s.
+	 * Averages never exceed 255 * s, so n is below 255 * s * s.
+	 */
+	if ((uint64_t)255 * threshold_s * threshold_s * threshold_s <
+	    ((uint64_t)1 << 32))
+		recip = ((uint64_t)1 << 32) / threshold_s + 1;
+
 	for (y = 0; y < q->h; y++) {
 		int row_average[q->w];
 
@@ -325,18 +351,19 @@ static void threshold(struct quirc *q)
 				u = x;
 			}
 
-			avg_w = (avg_w * (threshold_s - 1)) /
-				threshold_s + row[w];
-			avg_u = (avg_u * (threshold_s - 1)) /
-				threshold_s + row[u];
+			avg_w = threshold_div(avg_w * (threshold_s - 1),
+					      threshold_s, recip) + row[w];
+			avg_u = threshold_div(avg_u * (threshold_s - 1),
+					      threshold_s, recip) + row[u];
 
 			row_average[w] += avg_w;
 			row_average[u] += avg_u;
 		}
 
+		/* p < floor(a / d) is equivalent to (p + 1) * d <= a. */
 		for (x = 0; x < q->w; x++) {
-			if (row[x] < row_average[x] *
-			    (100 - THRESHOLD_T) / (200 * threshold_s))
+			if ((row[x] + 1) * threshold_d <=
+			    row_average[x] * (100 - THRESHOLD_T))
 				row[x] = QUIRC_PIXEL_BLACK;
 			else
 				row[x] = QUIRC_PIXEL_WHITE;
@@ -346,11 +373,74 @@ static void threshold(struct quirc *q)
 	}
 }
 
+/************************************************************************
+ * Region labelling
+ *
+ * Regions are labelled by flood filling their pixels with the region
+ * number the first time the finder looks at them. Numbers that don't fit
+ * in a pixel share QUIRC_PIXEL_OVERFLOW, and are kept in a separate map
+ * that is only allocated once a frame has that many regions.
+ */
+
+/* The pixel value a region is filled with */
+static inline int region_pixel(int region)
+{
+	return region < QUIRC_PIXEL_OVERFLOW ? region : QUIRC_PIXEL_OVERFLOW;
+}
+
+struct overflow_fill_data {
+	struct quirc		*q;
+	struct quirc_region	*box;
+	uint16_t		region;
+};
+
 static void area_count(void *user_data, int y, int left, int right)
 {
 	((struct quirc_region *)user_data)->count += right - left + 1;
 }
 
+static void area_count_overflow(void *user_data, int y, int left, int right)
+{
+	struct overflow_fill_data *ofd =
+		(struct overflow_fill_data *)user_data;
+	uint16_t *row = ofd->q->region_map + y * ofd->q->w;
+	int i;
+
+	for (i = left; i <= right; i++)
+		row[i] = ofd->region;
+
+	ofd->box->count += right - left + 1;
+}
+
+static int new_region(struct quirc *q)
+{
+	if (q->num_regions >= QUIRC_MAX_REGIONS)
+		return -1;
+
+	if (q->num_regions >= q->alloc_regions) {
+		int alloc = q->alloc_regions ? q->alloc_regions * 2 : 256;
+		struct quirc_region *regions;
+
+		if (alloc > QUIRC_MAX_REGIONS)
+			alloc = QUIRC_MAX_REGIONS;
+
+		regions = realloc(q->regions, alloc * sizeof(*regions));
+		if (!regions)
+			return -1;
+
+		q->regions = regions;
+		q->alloc_regions = alloc;
+	}
+
+	if (q->num_regions >= QUIRC_PIXEL_OVERFLOW && !q->region_map) {
+		q->region_map = malloc(q->w * q->h * sizeof(*q->region_map));
+		if (!q->region_map)
+			return -1;
+	}
+
+	return q->num_regions++;
+}
+
 static int region_code(struct quirc *q, int x, int y)
 {
 	int pixel;
@@ -362,17 +452,21 @@ static int region_code(struct quirc *q, int x, int y)
 
 	pixel = q->pixels[y * q->w + x];
 
-	if (pixel >= QUIRC_PIXEL_REGION)
+	if (pixel >= QUIRC_PIXEL_REGION) {
+		if (pixel == QUIRC_PIXEL_OVERFLOW)
+			return q->region_map[y * q->w + x];
+
 		return pixel;
+	}
 
 	if (pixel == QUIRC_PIXEL_WHITE)
 		return -1;
 
-	if (q->num_regions >= QUIRC_MAX_REGIONS)
+	region = new_region(q);
+	if (region < 0)
 		return -1;
 
-	region = q->num_regions;
-	box = &q->regions[q->num_regions++];
+	box = &q->regions[region];
 
 	memset(box, 0, sizeof(*box));
 
@@ -380,7 +474,18 @@ static int region_code(struct quirc *q, int x, int y)
 	box->seed.y = y;
 	box->capstone = -1;
 
-	flood_fill_seed(q, x, y, pixel, region, area_count, box);
+	if (region >= QUIRC_PIXEL_OVERFLOW) {
+		struct overflow_fill_data ofd;
+
+		ofd.q = q;
+		ofd.box = box;
+		ofd.region = region;
+
+		flood_fill_seed(q, x, y, pixel, QUIRC_PIXEL_OVERFLOW,
+				area_count_overflow, &ofd);
+	} else {
+		flood_fill_seed(q, x, y, pixel, region, area_count, box);
+	}
 
 	return region;
 }
@@ -449,7 +554,7 @@ static void find_region_corners(struct quirc *q,
 	memcpy(&psd.ref, ref, sizeof(psd.ref));
 	psd.scores[0] = -1;
 	flood_fill_seed(q, region->seed.x, region->seed.y,
-			rcode, QUIRC_PIXEL_BLACK,
+			region_pixel(rcode), QUIRC_PIXEL_BLACK,
 			find_one_corner, &psd);
 
 	psd.ref.x = psd.corners[0].x - psd.ref.x;
@@ -467,7 +572,7 @@ static void find_region_corners(struct quirc *q,
 	psd.scores[3] = -i;
 
 	flood_fill_seed(q, region->seed.x, region->seed.y,
-			QUIRC_PIXEL_BLACK, rcode,
+			QUIRC_PIXEL_BLACK, region_pixel(rcode),
 			find_other_corners, &psd);
 }
 
@@ -1080,10 +1185,11 @@ static void record_qr_grid(struct quirc *q, int a, int b, int c)
 				hd.x * qr->align.y;
 
 			flood_fill_seed(q, reg->seed.x, reg->seed.y,
-					qr->align_region, QUIRC_PIXEL_BLACK,
-					NULL, NULL);
+					region_pixel(qr->align_region),
+					QUIRC_PIXEL_BLACK, NULL, NULL);
 			flood_fill_seed(q, reg->seed.x, reg->seed.y,
-					QUIRC_PIXEL_BLACK, qr->align_region,
+					QUIRC_PIXEL_BLACK,
+					region_pixel(qr->align_region),
 					find_leftmost_to_line, &psd);
 		}
 	}
@@ -41,6 +41,8 @@ void quirc_destroy(struct quirc *q)
 	if (sizeof(*q->image) != sizeof(*q->pixels))
 		free(q->pixels);
 
+	free(q->regions);
+	free(q->region_map);
 	free(q);
 }
 
@@ -51,6 +53,8 @@ int quirc_resize(struct quirc *q, int w, int h)
 	if (!new_image)
 		return -1;
 
+	q->image = new_image;
+
 	if (sizeof(*q->image) != sizeof(*q->pixels)) {
 		size_t new_size = w * h * sizeof(quirc_pixel_t);
 		quirc_pixel_t *new_pixels = realloc(q->pixels, new_size);
@@ -59,7 +63,10 @@ int quirc_resize(struct quirc *q, int w, int h)
 		q->pixels = new_pixels;
 	}
 
-	q->image = new_image;
+	/* Reallocated at the new size once it is needed */
+	free(q->region_map);
+	q->region_map = NULL;
+
 	q->w = w;
 	q->h = h;
 
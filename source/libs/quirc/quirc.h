@@ -147,6 +147,14 @@ struct quirc_data {
 
 	/* ECI assignment number */
 	uint32_t		eci;
+
+	/* Structured append: this code is part sa_index of sa_size,
+	 * counting from 1, and sa_parity is the XOR of every byte of the
+	 * whole message. sa_size is 0 for standalone codes.
+	 */
+	int			sa_index;
+	int			sa_size;
+	int			sa_parity;
 };
 
 /* Return the number of QR-codes identified in the last processed
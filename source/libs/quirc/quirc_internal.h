@@ -22,23 +22,23 @@
 #define QUIRC_PIXEL_WHITE	0
 #define QUIRC_PIXEL_BLACK	1
 #define QUIRC_PIXEL_REGION	2
+#define QUIRC_PIXEL_OVERFLOW	UINT8_MAX
 
 #ifndef QUIRC_MAX_REGIONS
-#define QUIRC_MAX_REGIONS	254
+#define QUIRC_MAX_REGIONS	65534
 #endif
 #define QUIRC_MAX_CAPSTONES	32
 #define QUIRC_MAX_GRIDS		8
 
 #define QUIRC_PERSPECTIVE_PARAMS	8
 
-#if QUIRC_MAX_REGIONS < UINT8_MAX
-typedef uint8_t quirc_pixel_t;
-#elif QUIRC_MAX_REGIONS < UINT16_MAX
-typedef uint16_t quirc_pixel_t;
-#else
+#if QUIRC_MAX_REGIONS > UINT16_MAX - 1
 #error "QUIRC_MAX_REGIONS > 65534 is not supported"
 #endif
 
+/* Region numbers from QUIRC_PIXEL_OVERFLOW up are kept in region_map */
+typedef uint8_t quirc_pixel_t;
+
 struct quirc_region {
 	struct quirc_point	seed;
 	int			count;
@@ -81,7 +81,9 @@ struct quirc {
 	int			h;
 
 	int			num_regions;
-	struct quirc_region	regions[QUIRC_MAX_REGIONS];
+	int			alloc_regions;
+	struct quirc_region	*regions;
+	uint16_t		*region_map;
 
 	int			num_capstones;
 	struct quirc_capstone	capstones[QUIRC_MAX_CAPSTONES];
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <time.h>
+
+static inline double bench_time() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
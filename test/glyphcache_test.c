@@ -0,0 +1,246 @@
+// Checks the glyph cache against direct system font lookups, and with --bench times drawing
+// text through the cache against the per-character font calls it replaced.
+//
+// The font here mirrors the shape of the shared system font, in which most code points are
+// found by a linear scan of one large CMAP block, so timings are indicative rather than exact.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <3ds.h>
+
+#include "bench.h"
+#include "../source/core/glyphcache.h"
+
+#define FONT_GLYPHS 7000
+#define FONT_GLYPHS_PER_SHEET 100
+#define FONT_SHEETS (FONT_GLYPHS / FONT_GLYPHS_PER_SHEET)
+#define FONT_ASCII_BEGIN 0x20
+#define FONT_ASCII_END 0x7E
+
+// Mapped to a glyph past the last sheet, which the cache must replace with U+FFFD.
+#define FONT_BAD_SHEET_CODE 0xE000
+
+#define GLYPHCACHE_BENCH_RUNS 200
+
+typedef struct {
+    u16 code;
+    u16 glyphIndex;
+} font_scan_entry;
+
+static TGLP_s font_info = {FONT_SHEETS};
+static font_scan_entry font_scan[FONT_GLYPHS];
+static u32 font_scan_count;
+static charWidthInfo_s font_widths[FONT_GLYPHS + 1];
+static int font_replacement_index;
+
+static void font_init() {
+    u32 glyphIndex = FONT_ASCII_END - FONT_ASCII_BEGIN + 1;
+    for(u32 code = 0xA0; glyphIndex < FONT_GLYPHS - 2; code++) {
+        // Spread the rest over Latin, kana and CJK, as the shared font does.
+        if(code == 0x0250) {
+            code = 0x3040;
+        } else if(code == 0x3100) {
+            code = 0x4E00;
+        }
+
+        font_scan[font_scan_count].code = (u16) code;
+        font_scan[font_scan_count].glyphIndex = (u16) glyphIndex++;
+        font_scan_count++;
+    }
+
+    font_replacement_index = (int) glyphIndex;
+    font_scan[font_scan_count].code = 0xFFFD;
+    font_scan[font_scan_count].glyphIndex = (u16) glyphIndex++;
+    font_scan_count++;
+
+    font_scan[font_scan_count].code = FONT_BAD_SHEET_CODE;
+    font_scan[font_scan_count].glyphIndex = FONT_GLYPHS;
+    font_scan_count++;
+
+    for(u32 i = 0; i <= FONT_GLYPHS; i++) {
+        font_widths[i].left = (s8) (i % 3);
+        font_widths[i].glyphWidth = (u8) (8 + i % 17);
+        font_widths[i].charWidth = (u8) (10 + i % 13);
+    }
+}
+
+TGLP_s* fontGetGlyphInfo(CFNT_s* font) {
+    return &font_info;
+}
+
+int fontGlyphIndexFromCodePoint(CFNT_s* font, u32 codePoint) {
+    if(codePoint >= FONT_ASCII_BEGIN && codePoint <= FONT_ASCII_END) {
+        return (int) (codePoint - FONT_ASCII_BEGIN);
+    }
+
+    for(u32 i = 0; i < font_scan_count; i++) {
+        if(font_scan[i].code == codePoint) {
+            return font_scan[i].glyphIndex;
+        }
+    }
+
+    return font_replacement_index;
+}
+
+charWidthInfo_s* fontGetCharWidthInfo(CFNT_s* font, int glyphIndex) {
+    return &font_widths[glyphIndex];
+}
+
+void fontCalcGlyphPos(fontGlyphPos_s* out, CFNT_s* font, int glyphIndex, u32 flags, float scaleX, float scaleY) {
+    charWidthInfo_s* width = fontGetCharWidthInfo(font, glyphIndex);
+
+    int sheetGlyph = glyphIndex % FONT_GLYPHS_PER_SHEET;
+    float cellX = (float) (sheetGlyph % 10);
+    float cellY = (float) (sheetGlyph / 10);
+
+    out->sheetIndex = glyphIndex / FONT_GLYPHS_PER_SHEET;
+    out->xOffset = scaleX * width->left;
+    out->xAdvance = scaleX * width->charWidth;
+    out->width = scaleX * width->glyphWidth;
+
+    out->texcoord.left = cellX / 10.0f;
+    out->texcoord.top = 1.0f - cellY / 10.0f;
+    out->texcoord.right = (cellX + 1.0f) / 10.0f;
+    out->texcoord.bottom = 1.0f - (cellY + 1.0f) / 10.0f;
+
+    out->vtxcoord.left = out->xOffset;
+    out->vtxcoord.top = 0.0f;
+    out->vtxcoord.right = out->xOffset + out->width;
+    out->vtxcoord.bottom = scaleY * 30.0f;
+}
+
+static bool glyphcache_check(u32 code) {
+    int index = fontGlyphIndexFromCodePoint(NULL, code);
+
+    fontGlyphPos_s data;
+    fontCalcGlyphPos(&data, NULL, index, GLYPH_POS_CALC_VTXCOORD, 1.0f, 1.0f);
+
+    if(data.sheetIndex >= FONT_SHEETS) {
+        fontCalcGlyphPos(&data, NULL, font_replacement_index, GLYPH_POS_CALC_VTXCOORD, 1.0f, 1.0f);
+    }
+
+    const glyph_info* glyph = glyph_cache_get(code);
+    bool matched = glyph->cached
+            && glyph->sheet == (u32) data.sheetIndex
+            && glyph->charWidth == fontGetCharWidthInfo(NULL, index)->charWidth
+            && glyph->xAdvance == data.xAdvance
+            && glyph->left == data.vtxcoord.left
+            && glyph->top == data.vtxcoord.top
+            && glyph->right == data.vtxcoord.right
+            && glyph->bottom == data.vtxcoord.bottom
+            && glyph->texLeft == data.texcoord.left
+            && glyph->texBottom == data.texcoord.bottom
+            && glyph->texRight == data.texcoord.right
+            && glyph->texTop == data.texcoord.top
+            && glyph_cache_get(code) == glyph;
+
+    if(!matched) {
+        printf("U+%04lX: cached glyph differs from font lookup\n", (unsigned long) code);
+    }
+
+    return matched;
+}
+
+// Decodes UTF-8 text of up to three byte sequences to code points.
+static u32 glyphcache_decode(u32* codes, const char* text) {
+    u32 count = 0;
+
+    const u8* p = (const u8*) text;
+    while(*p != '\0') {
+        if(*p < 0x80) {
+            codes[count++] = *p;
+            p += 1;
+        } else if(*p < 0xE0) {
+            codes[count++] = ((u32) (p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+            p += 2;
+        } else {
+            codes[count++] = ((u32) (p[0] & 0x0F) << 12) | ((u32) (p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+            p += 3;
+        }
+    }
+
+    return count;
+}
+
+static void glyphcache_bench(const char* label, const char* text) {
+    u32 codes[256];
+    u32 count = glyphcache_decode(codes, text);
+
+    // Each character was looked up once to measure a line and once to draw it.
+    volatile float sink = 0;
+    double direct = 0;
+    double cached = 0;
+
+    for(int run = 0; run < GLYPHCACHE_BENCH_RUNS; run++) {
+        double start = bench_time();
+        for(u32 i = 0; i < count; i++) {
+            sink += fontGetCharWidthInfo(NULL, fontGlyphIndexFromCodePoint(NULL, codes[i]))->charWidth;
+
+            fontGlyphPos_s data;
+            fontCalcGlyphPos(&data, NULL, fontGlyphIndexFromCodePoint(NULL, codes[i]), GLYPH_POS_CALC_VTXCOORD, 0.5f, 0.5f);
+            sink += data.xAdvance;
+        }
+
+        double time = bench_time() - start;
+        if(run == 0 || time < direct) {
+            direct = time;
+        }
+
+        start = bench_time();
+        for(u32 i = 0; i < count; i++) {
+            sink += glyph_cache_get(codes[i])->charWidth;
+            sink += glyph_cache_get(codes[i])->xAdvance * 0.5f;
+        }
+
+        time = bench_time() - start;
+        if(run == 0 || time < cached) {
+            cached = time;
+        }
+    }
+
+    printf("%s, %lu characters: font lookups %.1f us, glyph cache %.1f us\n", label, (unsigned long) count, direct * 1e6, cached * 1e6);
+}
+
+int main(int argc, char** argv) {
+    font_init();
+
+    static const u32 codes[] = {
+        ' ', 'A', 'z', '~', 0xA0, 0xE9, 0x17F, 0x180, 0x24F, 0x3042, 0x30F3, 0x4E00, 0x5B57,
+        0xFFFD, FONT_BAD_SHEET_CODE, 0x1F600, 0x01, 0x7F
+    };
+
+    int failures = 0;
+    for(int pass = 0; pass < 2; pass++) {
+        for(u32 i = 0; i < sizeof(codes) / sizeof(codes[0]); i++) {
+            if(!glyphcache_check(codes[i])) {
+                failures++;
+            }
+        }
+
+        glyph_cache_clear();
+    }
+
+    // Enough CJK code points to spill the map's arena over several blocks.
+    for(u32 code = 0x4E00; code < 0x4E00 + 2000; code++) {
+        if(!glyphcache_check(code)) {
+            failures++;
+        }
+    }
+
+    glyph_cache_clear();
+
+    if(failures > 0) {
+        printf("%d glyph cache checks failed\n", failures);
+        return 1;
+    }
+
+    if(argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        glyphcache_bench("Latin", "Install and delete CIA - Installs the selected CIA file and deletes it afterwards.");
+        glyphcache_bench("Japanese", "\xe3\x81\x99\xe3\x81\xb9\xe3\x81\xa6\xe3\x81\xae\xe3\x82\xbf\xe3\x82\xa4\xe3\x83\x88\xe3\x83\xab\xe3\x82\x92\xe5\x89\x8a\xe9\x99\xa4\xe3\x81\x97\xe3\x81\xbe\xe3\x81\x99\xe3\x81\x8b\xe3\x80\x82\xe4\xb8\x80\xe4\xba\x8c\xe4\xb8\x89\xe5\x9b\x9b\xe4\xba\x94");
+    }
+
+    return 0;
+}
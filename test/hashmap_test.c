@@ -0,0 +1,301 @@
+// Tests the core hash maps, and with --bench compares their lookups against the linear scans
+// they replaced.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <3ds.h>
+
+#include "bench.h"
+#include "../source/core/hashmap.h"
+
+#define HASHMAP_TEST_KEYS 10000
+
+#define HASHMAP_BENCH_TITLES 500
+#define HASHMAP_BENCH_RUNS 200
+
+static int failures;
+
+#define EXPECT(cond) do { \
+    if(!(cond)) { \
+        printf("%s:%d: expected %s\n", __FILE__, __LINE__, #cond); \
+        failures++; \
+    } \
+} while(0)
+
+static u64 hashmap_test_key(u32 i) {
+    // Title ID style keys, sharing their high bits.
+    return 0x0004000000000000ULL | ((u64) i << 8);
+}
+
+static void* hashmap_test_value(u32 i) {
+    return (void*) (uintptr_t) (i + 1);
+}
+
+static void hashmap_test_insert() {
+    hash_map map;
+    hash_map_init(&map);
+
+    EXPECT(hash_map_size(&map) == 0);
+    EXPECT(hash_map_get(&map, 1) == NULL);
+    EXPECT(!hash_map_contains(&map, 1));
+    EXPECT(!hash_map_remove(&map, 1));
+
+    for(u32 i = 0; i < 100; i++) {
+        EXPECT(hash_map_put(&map, hashmap_test_key(i), hashmap_test_value(i)));
+    }
+
+    EXPECT(hash_map_size(&map) == 100);
+
+    for(u32 i = 0; i < 100; i++) {
+        EXPECT(hash_map_contains(&map, hashmap_test_key(i)));
+        EXPECT(hash_map_get(&map, hashmap_test_key(i)) == hashmap_test_value(i));
+    }
+
+    EXPECT(!hash_map_contains(&map, hashmap_test_key(100)));
+
+    // Putting an existing key replaces its value.
+    EXPECT(hash_map_put(&map, hashmap_test_key(7), hashmap_test_value(1000)));
+    EXPECT(hash_map_get(&map, hashmap_test_key(7)) == hashmap_test_value(1000));
+    EXPECT(hash_map_size(&map) == 100);
+
+    hash_map_clear(&map);
+    EXPECT(hash_map_size(&map) == 0);
+    EXPECT(!hash_map_contains(&map, hashmap_test_key(7)));
+
+    hash_map_destroy(&map);
+}
+
+static void hashmap_test_remove() {
+    hash_map map;
+    hash_map_init(&map);
+
+    for(u32 i = 0; i < 1000; i++) {
+        hash_map_put(&map, hashmap_test_key(i), hashmap_test_value(i));
+    }
+
+    // Every other key leaves a tombstone, which lookups of the rest must probe past.
+    for(u32 i = 0; i < 1000; i += 2) {
+        EXPECT(hash_map_remove(&map, hashmap_test_key(i)));
+    }
+
+    EXPECT(hash_map_size(&map) == 500);
+
+    for(u32 i = 0; i < 1000; i++) {
+        EXPECT(hash_map_contains(&map, hashmap_test_key(i)) == (i % 2 == 1));
+    }
+
+    EXPECT(!hash_map_remove(&map, hashmap_test_key(0)));
+
+    // Removed keys can be put back.
+    for(u32 i = 0; i < 1000; i += 2) {
+        EXPECT(hash_map_put(&map, hashmap_test_key(i), hashmap_test_value(i)));
+    }
+
+    for(u32 i = 0; i < 1000; i++) {
+        EXPECT(hash_map_get(&map, hashmap_test_key(i)) == hashmap_test_value(i));
+    }
+
+    // Churn must not fill the table with tombstones.
+    u32 capacity = map.capacity;
+    for(u32 i = 1000; i < 1000 + HASHMAP_TEST_KEYS * 10; i++) {
+        EXPECT(hash_map_put(&map, hashmap_test_key(i), hashmap_test_value(i)));
+        EXPECT(hash_map_remove(&map, hashmap_test_key(i)));
+    }
+
+    EXPECT(hash_map_size(&map) == 1000);
+    EXPECT(map.capacity <= capacity * 2);
+    EXPECT(map.used * 4 <= map.capacity * 3);
+
+    hash_map_destroy(&map);
+}
+
+static void hashmap_test_grow() {
+    hash_map map;
+    hash_map_init(&map);
+
+    for(u32 i = 0; i < HASHMAP_TEST_KEYS; i++) {
+        EXPECT(hash_map_put(&map, hashmap_test_key(i), hashmap_test_value(i)));
+
+        EXPECT((map.capacity & (map.capacity - 1)) == 0);
+        EXPECT(map.used * 4 <= map.capacity * 3);
+    }
+
+    EXPECT(hash_map_size(&map) == HASHMAP_TEST_KEYS);
+
+    for(u32 i = 0; i < HASHMAP_TEST_KEYS; i++) {
+        EXPECT(hash_map_get(&map, hashmap_test_key(i)) == hashmap_test_value(i));
+    }
+
+    hash_map_destroy(&map);
+    EXPECT(map.capacity == 0);
+}
+
+static void hashmap_test_string() {
+    static const char* paths[] = {
+        "sdmc:/cias/a.cia",
+        "sdmc:/cias/b.cia",
+        "sdmc:/cias/sub/a.cia",
+        "sdmc:/",
+        "",
+    };
+
+    string_map map;
+    string_map_init(&map);
+
+    for(u32 i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+        EXPECT(string_map_put(&map, paths[i], hashmap_test_value(i)));
+    }
+
+    // Lookups compare contents, not pointers.
+    char key[64];
+    for(u32 i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+        strcpy(key, paths[i]);
+        EXPECT(string_map_get(&map, key) == hashmap_test_value(i));
+    }
+
+    EXPECT(!string_map_contains(&map, "sdmc:/cias/c.cia"));
+    EXPECT(!string_map_contains(&map, "sdmc:/cias/a.ci"));
+
+    // Replacing a value also takes the new key, so the caller may free the old one.
+    strcpy(key, paths[0]);
+    EXPECT(string_map_put(&map, key, hashmap_test_value(100)));
+    EXPECT(string_map_size(&map) == sizeof(paths) / sizeof(paths[0]));
+    EXPECT(string_map_get(&map, paths[0]) == hashmap_test_value(100));
+
+    bool keyReplaced = false;
+    for(u32 i = 0; i < map.capacity; i++) {
+        keyReplaced |= map.keys[i] == key;
+    }
+
+    EXPECT(keyReplaced);
+    EXPECT(string_map_put(&map, paths[0], hashmap_test_value(100)));
+
+    EXPECT(string_map_remove(&map, paths[1]));
+    EXPECT(!string_map_contains(&map, paths[1]));
+    EXPECT(string_map_contains(&map, paths[2]));
+
+    // Grow with generated keys.
+    char* generated = (char*) malloc(HASHMAP_TEST_KEYS * 32);
+    EXPECT(generated != NULL);
+
+    if(generated != NULL) {
+        for(u32 i = 0; i < HASHMAP_TEST_KEYS; i++) {
+            snprintf(&generated[i * 32], 32, "sdmc:/cias/%lu.cia", (unsigned long) i);
+            EXPECT(string_map_put(&map, &generated[i * 32], hashmap_test_value(i)));
+        }
+
+        for(u32 i = 0; i < HASHMAP_TEST_KEYS; i++) {
+            snprintf(key, sizeof(key), "sdmc:/cias/%lu.cia", (unsigned long) i);
+            EXPECT(string_map_get(&map, key) == hashmap_test_value(i));
+        }
+    }
+
+    string_map_destroy(&map);
+    free(generated);
+}
+
+static void hashmap_bench() {
+    u64 ids[HASHMAP_BENCH_TITLES];
+    char paths[HASHMAP_BENCH_TITLES][64];
+
+    hash_map map;
+    hash_map_init(&map);
+
+    string_map pathMap;
+    string_map_init(&pathMap);
+
+    for(u32 i = 0; i < HASHMAP_BENCH_TITLES; i++) {
+        ids[i] = hashmap_test_key(i * 7919 % 100003);
+        snprintf(paths[i], sizeof(paths[i]), "sdmc:/cias/title_%08lX.cia", (unsigned long) (ids[i] >> 8));
+
+        hash_map_put(&map, ids[i], hashmap_test_value(i));
+        string_map_put(&pathMap, paths[i], hashmap_test_value(i));
+    }
+
+    // Look every title up once, as a cross-reference between two lists does.
+    volatile u32 found = 0;
+    double scan = 0;
+    double hashed = 0;
+    double stringScan = 0;
+    double stringHashed = 0;
+
+    for(int run = 0; run < HASHMAP_BENCH_RUNS; run++) {
+        double start = bench_time();
+        for(u32 i = 0; i < HASHMAP_BENCH_TITLES; i++) {
+            u64 id = ids[HASHMAP_BENCH_TITLES - 1 - i];
+            for(u32 j = 0; j < HASHMAP_BENCH_TITLES; j++) {
+                if(ids[j] == id) {
+                    found++;
+                    break;
+                }
+            }
+        }
+
+        double time = bench_time() - start;
+        if(run == 0 || time < scan) {
+            scan = time;
+        }
+
+        start = bench_time();
+        for(u32 i = 0; i < HASHMAP_BENCH_TITLES; i++) {
+            found += hash_map_contains(&map, ids[HASHMAP_BENCH_TITLES - 1 - i]);
+        }
+
+        time = bench_time() - start;
+        if(run == 0 || time < hashed) {
+            hashed = time;
+        }
+
+        start = bench_time();
+        for(u32 i = 0; i < HASHMAP_BENCH_TITLES; i++) {
+            const char* path = paths[HASHMAP_BENCH_TITLES - 1 - i];
+            for(u32 j = 0; j < HASHMAP_BENCH_TITLES; j++) {
+                if(strcmp(paths[j], path) == 0) {
+                    found++;
+                    break;
+                }
+            }
+        }
+
+        time = bench_time() - start;
+        if(run == 0 || time < stringScan) {
+            stringScan = time;
+        }
+
+        start = bench_time();
+        for(u32 i = 0; i < HASHMAP_BENCH_TITLES; i++) {
+            found += string_map_contains(&pathMap, paths[HASHMAP_BENCH_TITLES - 1 - i]);
+        }
+
+        time = bench_time() - start;
+        if(run == 0 || time < stringHashed) {
+            stringHashed = time;
+        }
+    }
+
+    printf("%d lookups among %d title IDs: linear scan %.1f us, hash_map %.1f us\n", HASHMAP_BENCH_TITLES, HASHMAP_BENCH_TITLES, scan * 1e6, hashed * 1e6);
+    printf("%d lookups among %d paths: linear scan %.1f us, string_map %.1f us\n", HASHMAP_BENCH_TITLES, HASHMAP_BENCH_TITLES, stringScan * 1e6, stringHashed * 1e6);
+
+    hash_map_destroy(&map);
+    string_map_destroy(&pathMap);
+}
+
+int main(int argc, char** argv) {
+    hashmap_test_insert();
+    hashmap_test_remove();
+    hashmap_test_grow();
+    hashmap_test_string();
+
+    if(failures > 0) {
+        printf("%d hash map checks failed\n", failures);
+        return 1;
+    }
+
+    if(argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        hashmap_bench();
+    }
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+// Stands in for libctru's header in host builds, for core code that only needs its types.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+
+// Host tests are single threaded.
+typedef s32 LightLock;
+
+static inline void LightLock_Init(LightLock* lock) {
+    *lock = 0;
+}
+
+static inline void LightLock_Lock(LightLock* lock) {
+}
+
+static inline void LightLock_Unlock(LightLock* lock) {
+}
+
+// System font interface. Tests that use it provide the functions over a font of their own.
+typedef struct {
+    s8 left;
+    u8 glyphWidth;
+    u8 charWidth;
+} charWidthInfo_s;
+
+typedef struct {
+    u8 nSheets;
+} TGLP_s;
+
+typedef struct {
+    int sheetIndex;
+    float xOffset;
+    float xAdvance;
+    float width;
+    struct {
+        float left;
+        float top;
+        float right;
+        float bottom;
+    } texcoord, vtxcoord;
+} fontGlyphPos_s;
+
+typedef struct CFNT_s CFNT_s;
+
+enum {
+    GLYPH_POS_CALC_VTXCOORD = 1 << 0,
+    GLYPH_POS_AT_BASELINE = 1 << 1,
+    GLYPH_POS_Y_POINTS_UP = 1 << 2,
+};
+
+TGLP_s* fontGetGlyphInfo(CFNT_s* font);
+int fontGlyphIndexFromCodePoint(CFNT_s* font, u32 codePoint);
+charWidthInfo_s* fontGetCharWidthInfo(CFNT_s* font, int glyphIndex);
+void fontCalcGlyphPos(fontGlyphPos_s* out, CFNT_s* font, int glyphIndex, u32 flags, float scaleX, float scaleY);
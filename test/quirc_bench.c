@@ -0,0 +1,101 @@
+// Times quirc_end over a corpus of PGM frames, and reports what it found in each, so runs
+// before and after a change to quirc can be compared. Generate a corpus with quirc_corpus.py.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "../source/libs/quirc/quirc_internal.h"
+
+#define QUIRC_BENCH_RUNS 20
+
+static unsigned char* quirc_bench_load_pgm(const char* path, int* width, int* height) {
+    FILE* fd = fopen(path, "rb");
+    if(fd == NULL) {
+        return NULL;
+    }
+
+    int max = 0;
+    unsigned char* image = NULL;
+    if(fscanf(fd, "P5 %d %d %d", width, height, &max) == 3 && fgetc(fd) != EOF && max == 255) {
+        size_t size = (size_t) *width * (size_t) *height;
+
+        image = (unsigned char*) malloc(size);
+        if(image != NULL && fread(image, 1, size, fd) != size) {
+            free(image);
+            image = NULL;
+        }
+    }
+
+    fclose(fd);
+    return image;
+}
+
+int main(int argc, char** argv) {
+    if(argc < 2) {
+        printf("usage: %s <frame.pgm>...\n", argv[0]);
+        return 1;
+    }
+
+    double total = 0;
+    int decoded = 0;
+
+    for(int i = 1; i < argc; i++) {
+        int width = 0;
+        int height = 0;
+        unsigned char* image = quirc_bench_load_pgm(argv[i], &width, &height);
+        if(image == NULL) {
+            printf("%s: failed to load\n", argv[i]);
+            return 1;
+        }
+
+        struct quirc* q = quirc_new();
+        if(q == NULL || quirc_resize(q, width, height) < 0) {
+            printf("%s: failed to allocate decoder\n", argv[i]);
+            return 1;
+        }
+
+        double best = 0;
+        for(int run = 0; run < QUIRC_BENCH_RUNS; run++) {
+            memcpy(quirc_begin(q, NULL, NULL), image, (size_t) width * (size_t) height);
+
+            double start = bench_time();
+            quirc_end(q);
+            double time = bench_time() - start;
+
+            if(run == 0 || time < best) {
+                best = time;
+            }
+        }
+
+        const char* payload = "-";
+        struct quirc_data data;
+        for(int code = 0; code < quirc_count(q); code++) {
+            struct quirc_code qrCode;
+            quirc_extract(q, code, &qrCode);
+
+            if(quirc_decode(&qrCode, &data) == QUIRC_SUCCESS) {
+                payload = (const char*) data.payload;
+                decoded++;
+                break;
+            }
+        }
+
+        int payloadLen = (int) strcspn(payload, "\n");
+        if(payloadLen > 40) {
+            payloadLen = 40;
+        }
+
+        const char* name = strrchr(argv[i], '/');
+        printf("%-12s %7.3f ms  regions %5d  capstones %2d  grids %d  %.*s\n", name != NULL ? name + 1 : argv[i], best * 1000, q->num_regions - QUIRC_PIXEL_REGION, q->num_capstones, q->num_grids, payloadLen, payload);
+
+        total += best;
+
+        quirc_destroy(q);
+        free(image);
+    }
+
+    printf("quirc_end: %.2f ms over %d frames, %d decoded\n", total * 1000, argc - 1, decoded);
+    return 0;
+}
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# Generates synthetic 400x240 camera frames containing QR codes, for quirc_bench.
+# Frames vary the QR version, scale, rotation, lighting, sensor noise and background clutter.
+# Requires the "qrcode" package.
+
+import math
+import os
+import random
+import sys
+
+import qrcode
+
+WIDTH = 400
+HEIGHT = 240
+
+
+def make_matrix(payload, version):
+    qr = qrcode.QRCode(version=version, error_correction=qrcode.constants.ERROR_CORRECT_M, border=0)
+    qr.add_data(qrcode.util.QRData(payload, mode=qrcode.util.MODE_8BIT_BYTE))
+    qr.make(fit=True)
+    return qr.get_matrix()
+
+
+def render(rng, matrix, module, angle, clutter):
+    size = len(matrix)
+    span = size * module
+    cx = rng.uniform(span * 0.6, WIDTH - span * 0.6) if span * 1.2 < WIDTH else WIDTH / 2
+    cy = rng.uniform(span * 0.6, HEIGHT - span * 0.6) if span * 1.2 < HEIGHT else HEIGHT / 2
+    cos = math.cos(angle)
+    sin = math.sin(angle)
+
+    # Lighting falls off linearly across the frame, in a random direction.
+    light_angle = rng.uniform(0, 2 * math.pi)
+    light_x = math.cos(light_angle) * rng.uniform(0.0, 0.5) / WIDTH
+    light_y = math.sin(light_angle) * rng.uniform(0.0, 0.5) / HEIGHT
+    paper = rng.randint(170, 235)
+    ink = rng.randint(20, 70)
+    noise = rng.uniform(2, 14)
+
+    # Clutter is dark speckle over the background, like a textured surface behind the code.
+    # Dense speckle makes the finder label lots of small regions.
+    dark = bytes(rng.random() < clutter for _ in range(WIDTH * HEIGHT))
+
+    out = bytearray(WIDTH * HEIGHT)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            dx = x - cx
+            dy = y - cy
+            u = (dx * cos + dy * sin) / module + size / 2
+            v = (-dx * sin + dy * cos) / module + size / 2
+
+            if 0 <= u < size and 0 <= v < size:
+                black = matrix[int(v)][int(u)]
+            elif -4 <= u < size + 4 and -4 <= v < size + 4:
+                black = False
+            else:
+                black = dark[y * WIDTH + x]
+
+            shade = 1.0 - abs(light_x * (x - WIDTH / 2) + light_y * (y - HEIGHT / 2)) * 2
+            value = (ink if black else paper) * shade + rng.gauss(0, noise)
+            out[y * WIDTH + x] = max(0, min(255, int(value)))
+
+    return out
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("usage: %s <output directory> [count]" % sys.argv[0])
+        return 1
+
+    directory = sys.argv[1]
+    count = int(sys.argv[2]) if len(sys.argv) > 2 else 40
+
+    os.makedirs(directory, exist_ok=True)
+
+    rng = random.Random(1)
+    for i in range(count):
+        urls = "\n".join("http://192.168.1.%d:8080/title%d.cia" % (rng.randint(2, 254), n) for n in range(rng.randint(1, 6)))
+        matrix = make_matrix(urls, rng.randint(2, 8))
+
+        module = rng.uniform(1.6, 200.0 / len(matrix))
+        angle = math.radians(rng.uniform(-30, 30))
+        # Every fourth frame is buried in clutter, enough to need more than 254 regions.
+        clutter = rng.uniform(0.3, 0.45) if i % 4 == 3 else rng.uniform(0.0, 0.05)
+
+        pixels = render(rng, matrix, module, angle, clutter)
+
+        with open(os.path.join(directory, "%02d.pgm" % i), "wb") as f:
+            f.write(b"P5 %d %d 255\n" % (WIDTH, HEIGHT))
+            f.write(pixels)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,153 @@
+// Checks quirc's thresholding against the original per-pixel division version, bit for bit,
+// and with --bench times both over camera-sized frames.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "../source/libs/quirc/identify.c"
+
+#define THRESHOLD_BENCH_RUNS 200
+
+static void threshold_reference(struct quirc* q) {
+    int avgW = 0;
+    int avgU = 0;
+    int thresholdS = q->w / THRESHOLD_S_DEN;
+    quirc_pixel_t* row = q->pixels;
+
+    for(int y = 0; y < q->h; y++) {
+        int rowAverage[q->w];
+        memset(rowAverage, 0, sizeof(rowAverage));
+
+        for(int x = 0; x < q->w; x++) {
+            int w = (y & 1) ? x : q->w - 1 - x;
+            int u = (y & 1) ? q->w - 1 - x : x;
+
+            avgW = (avgW * (thresholdS - 1)) / thresholdS + row[w];
+            avgU = (avgU * (thresholdS - 1)) / thresholdS + row[u];
+
+            rowAverage[w] += avgW;
+            rowAverage[u] += avgU;
+        }
+
+        for(int x = 0; x < q->w; x++) {
+            row[x] = row[x] < rowAverage[x] * (100 - THRESHOLD_T) / (200 * thresholdS) ? QUIRC_PIXEL_BLACK : QUIRC_PIXEL_WHITE;
+        }
+
+        row += q->w;
+    }
+}
+
+// Fills an image with noise over a gradient, with patches of solid black and white to push
+// the running averages to their extremes.
+static void threshold_fill(uint8_t* image, int width, int height, unsigned int seed) {
+    srand(seed);
+
+    for(int y = 0; y < height; y++) {
+        for(int x = 0; x < width; x++) {
+            int value = (x * 255 / width + y * 255 / height) / 2 + rand() % 96 - 48;
+
+            if((x / 16 + y / 16) % 7 == 0) {
+                value = 0;
+            } else if((x / 16 + y / 16) % 7 == 3) {
+                value = 255;
+            }
+
+            image[y * width + x] = (uint8_t) (value < 0 ? 0 : value > 255 ? 255 : value);
+        }
+    }
+}
+
+static bool threshold_check(int width, int height, unsigned int seed) {
+    struct quirc* expected = quirc_new();
+    struct quirc* actual = quirc_new();
+    if(expected == NULL || actual == NULL || quirc_resize(expected, width, height) < 0 || quirc_resize(actual, width, height) < 0) {
+        printf("%dx%d: failed to allocate\n", width, height);
+        return false;
+    }
+
+    threshold_fill(quirc_begin(expected, NULL, NULL), width, height, seed);
+    memcpy(quirc_begin(actual, NULL, NULL), expected->image, (size_t) width * (size_t) height);
+
+    pixels_setup(expected);
+    threshold_reference(expected);
+
+    pixels_setup(actual);
+    threshold(actual);
+
+    bool matched = memcmp(expected->pixels, actual->pixels, (size_t) width * (size_t) height * sizeof(quirc_pixel_t)) == 0;
+    if(!matched) {
+        printf("%dx%d seed %u: thresholded pixels differ\n", width, height, seed);
+    }
+
+    quirc_destroy(expected);
+    quirc_destroy(actual);
+    return matched;
+}
+
+static void threshold_bench(const char* name, void (*func)(struct quirc* q)) {
+    struct quirc* q = quirc_new();
+    if(q == NULL || quirc_resize(q, 400, 240) < 0) {
+        return;
+    }
+
+    uint8_t* image = (uint8_t*) malloc(400 * 240);
+    if(image == NULL) {
+        quirc_destroy(q);
+        return;
+    }
+
+    threshold_fill(image, 400, 240, 1);
+
+    double best = 0;
+    for(int run = 0; run < THRESHOLD_BENCH_RUNS; run++) {
+        memcpy(quirc_begin(q, NULL, NULL), image, 400 * 240);
+        pixels_setup(q);
+
+        double start = bench_time();
+        func(q);
+        double time = bench_time() - start;
+
+        if(run == 0 || time < best) {
+            best = time;
+        }
+    }
+
+    printf("%-10s %.3f ms per 400x240 frame\n", name, best * 1000);
+
+    free(image);
+    quirc_destroy(q);
+}
+
+int main(int argc, char** argv) {
+    // The reference divides by zero below a width of THRESHOLD_S_DEN. Widths past 2040 fall
+    // back to division, since the reciprocal is no longer exact.
+    static const int widths[] = {8, 9, 31, 32, 33, 200, 320, 400, 401, 1023, 2039, 2040, 2048, 4000};
+
+    int failed = 0;
+    for(unsigned int i = 0; i < sizeof(widths) / sizeof(widths[0]); i++) {
+        for(unsigned int seed = 1; seed <= 4; seed++) {
+            if(!threshold_check(widths[i], 24, seed)) {
+                failed++;
+            }
+        }
+    }
+
+    if(!threshold_check(400, 240, 5)) {
+        failed++;
+    }
+
+    if(failed > 0) {
+        printf("%d threshold checks failed\n", failed);
+        return 1;
+    }
+
+    if(argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        threshold_bench("reference", threshold_reference);
+        threshold_bench("threshold", threshold);
+    }
+
+    return 0;
+}
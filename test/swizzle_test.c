@@ -0,0 +1,259 @@
+// Checks the texture swizzlers against the original per-pixel Morton loop, and the fused
+// RGBA to ABGR swizzle against the original byte reversal pass followed by that loop, bit for
+// bit. With --bench times each pair over icon and screen sized images.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <3ds.h>
+
+#include "bench.h"
+#include "../source/core/swizzle.h"
+
+#define SWIZZLE_BENCH_RUNS 200
+
+static void swizzle_reference(u8* dst, const u8* src, u32 width, u32 height, u32 pow2Width, u32 pixelSize) {
+    for(u32 x = 0; x < width; x++) {
+        for(u32 y = 0; y < height; y++) {
+            u32 dstPos = ((((y >> 3) * (pow2Width >> 3) + (x >> 3)) << 6) + ((x & 1) | ((y & 1) << 1) | ((x & 2) << 1) | ((y & 2) << 2) | ((x & 4) << 2) | ((y & 4) << 3))) * pixelSize;
+            u32 srcPos = (y * width + x) * pixelSize;
+
+            memcpy(&dst[dstPos], &src[srcPos], pixelSize);
+        }
+    }
+}
+
+static void swizzle_rgba_to_abgr_reference(u8* dst, u8* image, u32 width, u32 height, u32 pow2Width) {
+    for(u32 x = 0; x < width; x++) {
+        for(u32 y = 0; y < height; y++) {
+            u32 pos = (y * width + x) * 4;
+
+            u8 c1 = image[pos + 0];
+            u8 c2 = image[pos + 1];
+            u8 c3 = image[pos + 2];
+            u8 c4 = image[pos + 3];
+
+            image[pos + 0] = c4;
+            image[pos + 1] = c3;
+            image[pos + 2] = c2;
+            image[pos + 3] = c1;
+        }
+    }
+
+    swizzle_reference(dst, image, width, height, pow2Width, 4);
+}
+
+static u32 swizzle_pow_2(u32 value) {
+    u32 pow2 = 64;
+    while(pow2 < value) {
+        pow2 <<= 1;
+    }
+
+    return pow2;
+}
+
+static void swizzle_fill(u8* data, u32 size, unsigned int seed) {
+    srand(seed);
+
+    for(u32 i = 0; i < size; i++) {
+        data[i] = (u8) rand();
+    }
+}
+
+// Swizzles the same image with the reference and with the path screen_load_texture_untiled
+// picks for its pixel size, into buffers holding the same garbage.
+static bool swizzle_check(u32 width, u32 height, u32 pixelSize) {
+    u32 pow2Width = swizzle_pow_2(width);
+    u32 pow2Height = swizzle_pow_2(height);
+    u32 size = pow2Width * pow2Height * pixelSize;
+
+    u8* src = (u8*) malloc(width * height * pixelSize);
+    u8* expected = (u8*) malloc(size);
+    u8* actual = (u8*) malloc(size);
+    if(src == NULL || expected == NULL || actual == NULL) {
+        printf("%lux%lu: failed to allocate\n", (unsigned long) width, (unsigned long) height);
+        return false;
+    }
+
+    swizzle_fill(src, width * height * pixelSize, width * 31 + height);
+    swizzle_fill(expected, size, 7);
+    memcpy(actual, expected, size);
+
+    swizzle_reference(expected, src, width, height, pow2Width, pixelSize);
+
+    if(pixelSize == 2) {
+        screen_swizzle_16((u16*) actual, (const u16*) src, width, height, pow2Width);
+    } else if(pixelSize == 4) {
+        screen_swizzle_32((u32*) actual, (const u32*) src, width, height, pow2Width);
+    } else {
+        screen_swizzle_generic(actual, src, width, height, pow2Width, pixelSize);
+    }
+
+    bool matched = memcmp(expected, actual, size) == 0;
+    if(!matched) {
+        printf("%lux%lu, %lu bytes per pixel: swizzled texture differs from reference\n", (unsigned long) width, (unsigned long) height, (unsigned long) pixelSize);
+    }
+
+    free(src);
+    free(expected);
+    free(actual);
+    return matched;
+}
+
+static bool swizzle_rgba_to_abgr_check(u32 width, u32 height) {
+    u32 pow2Width = swizzle_pow_2(width);
+    u32 pow2Height = swizzle_pow_2(height);
+    u32 size = pow2Width * pow2Height * 4;
+
+    u8* src = (u8*) malloc(width * height * 4);
+    u8* image = (u8*) malloc(width * height * 4);
+    u8* expected = (u8*) malloc(size);
+    u8* actual = (u8*) malloc(size);
+    if(src == NULL || image == NULL || expected == NULL || actual == NULL) {
+        printf("%lux%lu: failed to allocate\n", (unsigned long) width, (unsigned long) height);
+        return false;
+    }
+
+    swizzle_fill(src, width * height * 4, width * 31 + height);
+    memcpy(image, src, width * height * 4);
+    swizzle_fill(expected, size, 7);
+    memcpy(actual, expected, size);
+
+    swizzle_rgba_to_abgr_reference(expected, image, width, height, pow2Width);
+    screen_swizzle_rgba_to_abgr((u32*) actual, (const u32*) src, width, height, pow2Width);
+
+    bool matched = memcmp(expected, actual, size) == 0;
+    if(!matched) {
+        printf("%lux%lu, RGBA to ABGR: swizzled texture differs from reference\n", (unsigned long) width, (unsigned long) height);
+    }
+
+    free(src);
+    free(image);
+    free(expected);
+    free(actual);
+    return matched;
+}
+
+static void swizzle_bench(u32 width, u32 height, u32 pixelSize) {
+    u32 pow2Width = swizzle_pow_2(width);
+    u32 pow2Height = swizzle_pow_2(height);
+
+    u8* src = (u8*) malloc(width * height * pixelSize);
+    u8* dst = (u8*) malloc(pow2Width * pow2Height * pixelSize);
+    if(src == NULL || dst == NULL) {
+        return;
+    }
+
+    swizzle_fill(src, width * height * pixelSize, 1);
+
+    double reference = 0;
+    double swizzled = 0;
+
+    for(int run = 0; run < SWIZZLE_BENCH_RUNS; run++) {
+        double start = bench_time();
+        swizzle_reference(dst, src, width, height, pow2Width, pixelSize);
+
+        double time = bench_time() - start;
+        if(run == 0 || time < reference) {
+            reference = time;
+        }
+
+        start = bench_time();
+        if(pixelSize == 2) {
+            screen_swizzle_16((u16*) dst, (const u16*) src, width, height, pow2Width);
+        } else {
+            screen_swizzle_32((u32*) dst, (const u32*) src, width, height, pow2Width);
+        }
+
+        time = bench_time() - start;
+        if(run == 0 || time < swizzled) {
+            swizzled = time;
+        }
+    }
+
+    printf("%lux%lu, %lu bytes per pixel: reference %.1f us, swizzle %.1f us\n", (unsigned long) width, (unsigned long) height, (unsigned long) pixelSize, reference * 1e6, swizzled * 1e6);
+
+    free(src);
+    free(dst);
+}
+
+// The reference reverses the image in place, so each run gets a fresh copy, outside the timing.
+static void swizzle_rgba_to_abgr_bench(u32 width, u32 height) {
+    u32 pow2Width = swizzle_pow_2(width);
+    u32 pow2Height = swizzle_pow_2(height);
+
+    u8* src = (u8*) malloc(width * height * 4);
+    u8* image = (u8*) malloc(width * height * 4);
+    u8* dst = (u8*) malloc(pow2Width * pow2Height * 4);
+    if(src == NULL || image == NULL || dst == NULL) {
+        return;
+    }
+
+    swizzle_fill(src, width * height * 4, 1);
+
+    double reference = 0;
+    double swizzled = 0;
+
+    for(int run = 0; run < SWIZZLE_BENCH_RUNS; run++) {
+        memcpy(image, src, width * height * 4);
+
+        double start = bench_time();
+        swizzle_rgba_to_abgr_reference(dst, image, width, height, pow2Width);
+
+        double time = bench_time() - start;
+        if(run == 0 || time < reference) {
+            reference = time;
+        }
+
+        start = bench_time();
+        screen_swizzle_rgba_to_abgr((u32*) dst, (const u32*) src, width, height, pow2Width);
+
+        time = bench_time() - start;
+        if(run == 0 || time < swizzled) {
+            swizzled = time;
+        }
+    }
+
+    printf("%lux%lu, RGBA to ABGR: reference %.1f us, swizzle %.1f us\n", (unsigned long) width, (unsigned long) height, reference * 1e6, swizzled * 1e6);
+
+    free(src);
+    free(image);
+    free(dst);
+}
+
+int main(int argc, char** argv) {
+    static const u32 sizes[] = {1, 3, 7, 8, 9, 15, 48, 63, 64, 65, 100, 240, 400};
+    static const u32 pixelSizes[] = {1, 2, 3, 4};
+
+    int failures = 0;
+    for(u32 w = 0; w < sizeof(sizes) / sizeof(sizes[0]); w++) {
+        for(u32 h = 0; h < sizeof(sizes) / sizeof(sizes[0]); h++) {
+            for(u32 p = 0; p < sizeof(pixelSizes) / sizeof(pixelSizes[0]); p++) {
+                if(!swizzle_check(sizes[w], sizes[h], pixelSizes[p])) {
+                    failures++;
+                }
+            }
+
+            if(!swizzle_rgba_to_abgr_check(sizes[w], sizes[h])) {
+                failures++;
+            }
+        }
+    }
+
+    if(failures > 0) {
+        printf("%d swizzle checks failed\n", failures);
+        return 1;
+    }
+
+    if(argc > 1 && strcmp(argv[1], "--bench") == 0) {
+        swizzle_bench(48, 48, 4);
+        swizzle_bench(400, 240, 2);
+        swizzle_bench(400, 240, 4);
+
+        swizzle_rgba_to_abgr_bench(48, 48);
+        swizzle_rgba_to_abgr_bench(400, 240);
+    }
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+// Times loading theme PNGs the way screen_load_texture_file does: a stb_image decode, then the
+// fused RGBA to ABGR swizzle, against the original byte reversal pass followed by the per-pixel
+// Morton loop. Checks both paths agree for each file. Run it over romfs/*.png.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <3ds.h>
+
+#include "bench.h"
+#include "../source/core/swizzle.h"
+#include "../source/libs/stb_image/stb_image.h"
+
+#define THEME_BENCH_RUNS 50
+
+static void theme_bench_reference(u8* dst, u8* image, u32 width, u32 height, u32 pow2Width) {
+    for(u32 x = 0; x < width; x++) {
+        for(u32 y = 0; y < height; y++) {
+            u32 pos = (y * width + x) * 4;
+
+            u8 c1 = image[pos + 0];
+            u8 c2 = image[pos + 1];
+            u8 c3 = image[pos + 2];
+            u8 c4 = image[pos + 3];
+
+            image[pos + 0] = c4;
+            image[pos + 1] = c3;
+            image[pos + 2] = c2;
+            image[pos + 3] = c1;
+        }
+    }
+
+    for(u32 x = 0; x < width; x++) {
+        for(u32 y = 0; y < height; y++) {
+            u32 dstPos = ((((y >> 3) * (pow2Width >> 3) + (x >> 3)) << 6) + ((x & 1) | ((y & 1) << 1) | ((x & 2) << 1) | ((y & 2) << 2) | ((x & 4) << 2) | ((y & 4) << 3))) * 4;
+            u32 srcPos = (y * width + x) * 4;
+
+            memcpy(&dst[dstPos], &image[srcPos], 4);
+        }
+    }
+}
+
+static u32 theme_bench_pow_2(u32 value) {
+    u32 pow2 = 64;
+    while(pow2 < value) {
+        pow2 <<= 1;
+    }
+
+    return pow2;
+}
+
+// Decodes a PNG with stb_image as screen_load_texture_file does, returning the time taken.
+static u8* theme_bench_decode(const char* path, int* width, int* height, double* time) {
+    FILE* fd = fopen(path, "rb");
+    if(fd == NULL) {
+        return NULL;
+    }
+
+    int depth = 0;
+
+    double start = bench_time();
+    u8* image = stbi_load_from_file(fd, width, height, &depth, STBI_rgb_alpha);
+    *time = bench_time() - start;
+
+    fclose(fd);
+    return image;
+}
+
+int main(int argc, char** argv) {
+    if(argc < 2) {
+        printf("usage: %s <image.png>...\n", argv[0]);
+        return 1;
+    }
+
+    int failures = 0;
+
+    double totalDecode = 0;
+    double totalReference = 0;
+    double totalSwizzled = 0;
+
+    for(int i = 1; i < argc; i++) {
+        int width = 0;
+        int height = 0;
+
+        double decode = 0;
+        u8* src = NULL;
+        for(int run = 0; run < THEME_BENCH_RUNS; run++) {
+            double time = 0;
+
+            free(src);
+            src = theme_bench_decode(argv[i], &width, &height, &time);
+            if(src == NULL) {
+                break;
+            }
+
+            if(run == 0 || time < decode) {
+                decode = time;
+            }
+        }
+
+        if(src == NULL) {
+            printf("%s: failed to decode\n", argv[i]);
+            failures++;
+            continue;
+        }
+
+        u32 pow2Width = theme_bench_pow_2((u32) width);
+        u32 pow2Height = theme_bench_pow_2((u32) height);
+        u32 imageSize = (u32) width * (u32) height * 4;
+        u32 textureSize = pow2Width * pow2Height * 4;
+
+        u8* image = (u8*) malloc(imageSize);
+        u8* expected = (u8*) calloc(1, textureSize);
+        u8* actual = (u8*) calloc(1, textureSize);
+        if(image == NULL || expected == NULL || actual == NULL) {
+            free(src);
+            free(image);
+            free(expected);
+            free(actual);
+            return 1;
+        }
+
+        double reference = 0;
+        double swizzled = 0;
+
+        for(int run = 0; run < THEME_BENCH_RUNS; run++) {
+            // The reference reverses the image in place, so each run gets a fresh copy, outside the timing.
+            memcpy(image, src, imageSize);
+
+            double start = bench_time();
+            theme_bench_reference(expected, image, (u32) width, (u32) height, pow2Width);
+
+            double time = bench_time() - start;
+            if(run == 0 || time < reference) {
+                reference = time;
+            }
+
+            start = bench_time();
+            screen_swizzle_rgba_to_abgr((u32*) actual, (const u32*) src, (u32) width, (u32) height, pow2Width);
+
+            time = bench_time() - start;
+            if(run == 0 || time < swizzled) {
+                swizzled = time;
+            }
+        }
+
+        if(memcmp(expected, actual, textureSize) != 0) {
+            printf("%s: swizzled texture differs from reference\n", argv[i]);
+            failures++;
+        }
+
+        printf("%s: %dx%d, decode %.1f us, reference %.1f us, swizzle %.1f us\n", argv[i], width, height, decode * 1e6, reference * 1e6, swizzled * 1e6);
+
+        totalDecode += decode;
+        totalReference += reference;
+        totalSwizzled += swizzled;
+
+        free(src);
+        free(image);
+        free(expected);
+        free(actual);
+    }
+
+    printf("total: decode %.1f us, reference %.1f us, swizzle %.1f us\n", totalDecode * 1e6, totalReference * 1e6, totalSwizzled * 1e6);
+
+    return failures > 0 ? 1 : 0;
+}